@@ -0,0 +1,25 @@
+/*
+  CRC-16/CCITT (poly 0x1021, init 0xFFFF), shared by the settings store, the job library and the serial protocol.
+  No Arduino dependencies so the host side tools can use it too.
+*/
+#ifndef CRC16_H
+#define CRC16_H
+
+#include <stdint.h>
+
+/** @brief CRC-16/CCITT of a block of bytes
+    @param data    : bytes to check
+    @param length  : number of bytes
+*/
+inline uint16_t CRC16(const uint8_t *data, int length) {
+  uint16_t crc = 0xFFFF;
+  for (int i = 0; i < length; i++) {
+    crc ^= (uint16_t)data[i] << 8;
+    for (int bit = 0; bit < 8; bit++) {
+      if (crc & 0x8000) {crc = (crc << 1) ^ 0x1021;} else {crc = crc << 1;}
+    }
+  }
+  return crc;
+}
+
+#endif
@@ -0,0 +1,119 @@
+/*
+  G-code line parser - shared by the firmware and host side tools.
+
+  Splits one line of lathe G-code into its words.  Nothing here knows about the machine: the
+  firmware turns a parsed block into motion segments (src/GCode.h), a PC tool can include this
+  file to check a program, or time the parser, before it is sent.
+
+  Supported syntax: letter/number words in upper or lower case, spaces anywhere between words,
+  ( ) comments and ; to the end of the line, a leading N line number is skipped.  Up to
+  GCode_Max_G G words and one M word per line.  Numbers are parsed here rather than with strtod
+  so the result does not depend on the C library or locale.
+*/
+#ifndef GCODE_PARSER_H
+#define GCODE_PARSER_H
+
+#include <stdint.h>
+
+//----Parse Results----//
+  const int GCode_OK = 0;
+  const int GCode_Empty = 1;                  // blank line or only a comment
+  const int GCode_Bad_Word = 2;               // character that does not start a word
+  const int GCode_Bad_Number = 3;             // letter with no number after it
+  const int GCode_Bad_Comment = 4;            // ( with no )
+  const int GCode_Repeated = 5;               // same axis or parameter letter twice, or too many G words
+  // reported by the interpreter rather than the parser
+  const int GCode_Unsupported = 6;            // G or M code the lathe does not run
+  const int GCode_Missing = 7;                // word the command needs was not given (feed, lead, arc center)
+  const int GCode_Bad_Arc = 8;                // arc end point is not on the circle
+  const int GCode_Too_Long = 9;               // line longer than the receive buffer
+
+  const int GCode_Max_G = 4;
+
+//----Parsed Line----//
+  struct GCode_Block {
+    int G[GCode_Max_G];                       // G numbers times 10, G33 = 330, G76 = 760, G92.1 = 921
+    int G_Count;
+    int M;                                    // M number, -1 = none
+    uint32_t Words;                           // bit (letter - 'A') set for every letter other than G and M that was given
+    double Value[26];                         // value of each letter in Words
+  };
+
+/** @brief True if the block holds the letter
+    @param block   : parsed line
+    @param letter  : upper case word letter
+*/
+inline bool GCode_Has(const GCode_Block *block, char letter) {return block->Words & (1UL << (letter - 'A'));}
+
+/** @brief Reads a number with an optional sign and decimal point.  Returns the characters used, 0 if there was no number
+    @param text   : first character of the number
+    @param value  : number read
+*/
+inline int GCode_Number(const char *text, double *value) {
+  int i = 0;
+  double sign = 1;
+  if (text[i] == '+' || text[i] == '-') {if (text[i] == '-') {sign = -1;} i++;}
+  double whole = 0;
+  int digits = 0;
+  while (text[i] >= '0' && text[i] <= '9') {whole = whole * 10 + (text[i] - '0'); i++; digits++;}
+  if (text[i] == '.') {
+    i++;
+    double scale = 0.1;
+    while (text[i] >= '0' && text[i] <= '9') {whole += (text[i] - '0') * scale; scale *= 0.1; i++; digits++;}
+  }
+  if (digits == 0) {return 0;}
+  *value = sign * whole;
+  return i;
+}
+
+/**
+  @brief Parses one line, without its line ending.  Returns GCode_OK with the block filled in,
+         GCode_Empty for a line with nothing to do, or one of the errors above
+  @param line   : zero terminated line
+  @param block  : words found on the line
+*/
+inline int GCode_Parse_Line(const char *line, GCode_Block *block) {
+  block->G_Count = 0;
+  block->M = -1;
+  block->Words = 0;
+  bool found = false;
+
+  int i = 0;
+  while (line[i] != 0) {
+    char c = line[i];
+    if (c == ' ' || c == '\t' || c == '\r') {i++; continue;}
+    if (c == ';') {break;}
+    if (c == '(') {
+      while (line[i] != 0 && line[i] != ')') {i++;}
+      if (line[i] == 0) {return GCode_Bad_Comment;}
+      i++;
+      continue;
+    }
+    if (c >= 'a' && c <= 'z') {c = c - 'a' + 'A';}
+    if (c < 'A' || c > 'Z') {return GCode_Bad_Word;}
+    i++;
+    while (line[i] == ' ' || line[i] == '\t') {i++;}          // "G 1" is legal G-code
+    double value;
+    int used = GCode_Number(line + i, &value);
+    if (used == 0) {return GCode_Bad_Number;}
+    i += used;
+
+    if (c == 'N') {continue;}
+    found = true;
+    if (c == 'G') {
+      if (block->G_Count >= GCode_Max_G) {return GCode_Repeated;}
+      block->G[block->G_Count++] = (int)(value * 10 + 0.5);
+    } else if (c == 'M') {
+      if (block->M != -1) {return GCode_Repeated;}
+      block->M = (int)(value + 0.5);
+    } else {
+      uint32_t bit = 1UL << (c - 'A');
+      if (block->Words & bit) {return GCode_Repeated;}
+      block->Words |= bit;
+      block->Value[c - 'A'] = value;
+    }
+  }
+  return found ? GCode_OK : GCode_Empty;
+}
+
+#endif
@@ -14,6 +14,12 @@
 #include "TeensyTimerTool.h"
 #include "Adafruit_seesaw.h"
 #include <Metro.h>
+#include <LittleFS.h>
+#include "Settings_Store.h"
+#include "Protocol_Codec.h"
+#include "Sync_Ratio.h"
+#include "Polygon_Profile.h"
+#include "GCode_Parser.h"
 //#include <seesaw_neopixel.h> 
 
 
@@ -33,12 +39,14 @@ double Refresh_Rate = 200000;
   const double MaxLeadRPM = 600;                              // Leadscrew Max RPM
   const double CrossSPR = 6400;                               // Cross slide steps per rev
   const double MaxCrossRPM = 250;                             // Cross slide max RPM
+  const double Rapid_Ramp_Time = .1;                          // seconds from a stop to full speed on accelerated rapids
+  const int Retract_Dir = 1;                                  // cross slide step direction that pulls the tool away from the work
 
 //----Menu Specific----//
   int Metric = 0;                                      // Metric designation 0=Inch 1=Metric
   int Thread_Mode =  0;                                // Thread Mode Designation 0=TPI  1=Pitch
-  int Mode;                                             // 1=feed 2=thread 3=auto thread 4=turn to diameter 5=manual_Z 6=manual_X 7=radius 8=chamfer
-  volatile int S_Dir = 2;                              // set direction to park, 0=left 1=right 2=park
+  int Mode;                                             // 1=feed 2=thread 3=auto thread 4=turn to diameter 5=manual_Z 6=manual_X 7=radius 8=chamfer 9=G-code
+  volatile int S_Dir = 2;                              // spindle direction from RPM_Calc(), 0=reverse 1=forward 2=stopped
   int Menu_pos = 3;
   double In_FeedRate = .001;                             // Initial Inch Feed Rate
   double mm_FeedRate = .01;                              // Initial mm Feed Rate
@@ -61,6 +69,26 @@ double Refresh_Rate = 200000;
   double mm_DOC = .25;
   double in_length_of_cut = .5;
   double mm_length_of_cut = 12;
+  double in_Thread_Stop = 0;                             // Thread mode leadscrew stop, this far along the thread from where the lock was taken, 0 = off
+  double mm_Thread_Stop = 0;
+  double Thread_Pull_Angle = 0;                          // thread end pull out, degrees off the Z axis the cross slide retracts along as the leadscrew runs on, 0 = off
+  const double Thread_Pull_Angle_Max = 80;
+  long Thread_Start_Z = 0;                               // leadscrew steps where Thread mode took the lock
+  int Thread_Starts = 1;                                 // starts Auto Thread cuts, each from its own spindle angle 360/Thread_Starts apart
+  const int Thread_Starts_Max = 8;
+  long long Thread_Num, Thread_Den;                      // Auto Thread plan, worked out by Thread_Plan().  Leadscrew steps per spindle count
+  long Thread_Length;                                    // steps
+  long Thread_Depth;
+  long Thread_DOC;                                       // depth of the first pass
+  int Thread_Levels;                                     // depths each start is cut to before the spring pass
+  int Thread_Taper = 0;                                  // Auto Thread form, 0 = straight, 1 = NPT, 2 = BSPT, see Taper_Thread_Array
+  const long Pipe_Taper = 32;                            // length per unit of radius, 1:16 on the diameter
+  int Thread_Dir;                                        // Z the cut runs, -1 = toward the headstock, 1 = toward the tailstock
+  long Thread_Z_Start;                                   // steps, where each pass leads in and pulls out
+  long Thread_Z_End;
+  long Thread_Ramp;                                      // spindle counts each pass ramps the leadscrew up over, planned for the spindle speed at the start
+  long Thread_Lead_In;                                   // steps the ramp covers before the leadscrew is at full speed
+  double Thread_Max_RPM;                                 // fastest spindle the leadscrew can keep up with on this thread
   double rpm;
 
 //----Radius Variables----//
@@ -76,6 +104,111 @@ double Refresh_Rate = 200000;
   double Cut_Depth;
   int Cut_Passes;
 
+//----Taper Variables----//
+  // start diameter is in_Outside_Diameter at the tailstock end, end diameter in_Final_Diameter in_length_of_cut toward the headstock
+  int Taper_type = 0;          // 0=start and end diameters; 1=start diameter and angle
+  double Taper_Angle = 3;      // degrees from the spindle axis, + = smaller toward the headstock
+  long Taper_Length;           // cycle plan in steps, worked out by Taper_Plan()
+  long Taper_Start_X;          // taper line at the start and end, outward from the stock surface
+  long Taper_End_X;
+  long Taper_Finish;           // finish pass allowance
+  long Taper_DOC;
+  int Taper_Passes;            // roughing passes, the finishing pass comes after them
+
+//----Chamfer Variables----//
+  int Chamfer_type = 0;        // 0=OD right; 1=OD left; 2=ID right; 3=ID left.  right = chamfer on a face toward the tailstock
+  double in_Chamfer_Size = .05;  // length of the chamfer along Z
+  double mm_Chamfer_Size = 1;
+  double Chamfer_Angle = 45;   // degrees from the spindle axis
+  long Chamfer_Z;              // cycle plan in steps, worked out by Chamfer_Plan()
+  long Chamfer_X;
+  long Chamfer_Depth;          // depth square to the chamfer face
+  long Chamfer_Finish;
+  int Chamfer_Passes;          // roughing passes, the finishing pass comes after them
+
+//----Ball Variables----//
+  // stock diameter is in_Outside_Diameter, the ball's tip is at the end face
+  int Ball_type = 0;           // 0=hemisphere; 1=full sphere on a neck
+  double in_Ball_Diameter = .5;
+  double mm_Ball_Diameter = 12;
+  double in_Ball_Neck = .2;    // neck diameter left behind a full sphere
+  double mm_Ball_Neck = 5;
+  long Ball_Stock;             // cycle plan in steps, worked out by Ball_Plan()
+  long Ball_R;
+  long Ball_Neck_R;
+  long Ball_Finish;
+  long Ball_DOC;
+  int Ball_Levels;             // roughing levels, the finishing arc comes after them
+  int Ball_Chords;
+
+//----Face Variables----//
+  // stock diameter is in_Outside_Diameter, faced from the diameter to the center
+  int Face_type = 0;           // 0=feed per rev; 1=feed per minute
+  double in_Face_Rate = 2;     // feed per minute for Face_type 1
+  double mm_Face_Rate = 50;
+  double in_Face_Depth = .02;  // stock to take off the face
+  double mm_Face_Depth = .5;
+  long Face_Stock;             // cycle plan in steps, worked out by Face_Plan()
+  long Face_Depth;
+  long Face_Finish;
+  long Face_DOC;
+  int Face_Passes;             // roughing passes, the finishing pass comes after them
+
+//----Parting Variables----//
+  // stock diameter is in_Outside_Diameter, touch off on it at the parting position
+  double in_Part_Diameter = 0;   // the cycle stops here, 0 = parts right off
+  double mm_Part_Diameter = 0;
+  int Part_Peck_Revs = 0;        // spindle revs of feed between pecks, 0 = no pecks
+  double in_Part_Retract = .05;  // how far each peck backs out of the cut
+  double mm_Part_Retract = 1;
+  long Part_Depth;               // cycle plan in steps, worked out by Part_Plan()
+  long Part_Peck;
+  long Part_Retract;
+  long Part_Gap;                 // re-entry is fed from one rev of feed short of the bottom
+  int Part_Pecks;
+
+//----Groove Variables----//
+  // touch off on the stock diameter with the tool's tailstock side edge on the end face
+  double in_Groove_Position = .25;   // end face to the near wall of the groove
+  double mm_Groove_Position = 6;
+  double in_Groove_Width = .125;
+  double mm_Groove_Width = 3;
+  double in_Groove_Depth = .05;      // below the stock diameter
+  double mm_Groove_Depth = 1.25;
+  double in_Groove_Tool = .0625;     // cutting width of the tool
+  double mm_Groove_Tool = 1.5;
+  double Groove_Dwell = 1;           // spindle revs at the bottom of each plunge
+  const double Groove_Overlap = .2;  // least part of the tool width each plunge overlaps the last
+  long Groove_Near;                  // cycle plan in steps, worked out by Groove_Plan(). Tool edge at the near wall
+  long Groove_Far;                   // tool edge at the far wall, the tool covers the rest of the groove
+  long Groove_Depth;
+  long Groove_Finish;
+  int Groove_Plunges;                // roughing plunges, the finishing sweep comes after them
+
+//----Polygon Variables----//
+  // the cross slide follows the spindle angle while the leadscrew feeds, touch off on a flat (polygon) or the low side (eccentric)
+  int Polygon_type = 0;              // 0=polygon; 1=eccentric
+  int Polygon_Sides = 6;
+  double in_Polygon_Size = .5;       // across the flats, or the eccentric diameter
+  double mm_Polygon_Size = 12;
+  double in_Polygon_Offset = .05;    // eccentric center off the spindle axis
+  double mm_Polygon_Offset = 1.25;
+  double in_Polygon_Length = .5;     // leadscrew travel toward the headstock
+  double mm_Polygon_Length = 12;
+  const int Polygon_Table_Max = 8192;  // most spindle counts per rev the table can hold
+  long Polygon_Table[Polygon_Table_Max];   // cross slide steps out from the start at each spindle count, built by Polygon_Build()
+  long Polygon_Table_Length = 0;     // SpindleCPR, 0 = no table
+  double Polygon_Max_RPM = 0;        // fastest spindle the cross slide can follow the table at
+
+//----Chip Breaking----//
+  // synchronized feeds other than threads stop, or back off and come back, for a few spindle degrees every few revs.
+  // The feed between breaks runs faster to make up for them, so the axis is back on the locked position at the end of
+  // every Chip_Break_Revs and the feed per rev over them is exact
+  int Chip_Break = 0;            // 0=off; 1=pause; 2=back off
+  int Chip_Break_Revs = 3;       // spindle revs from the start of one break to the next
+  double Chip_Break_Degrees = 45;  // spindle degrees each break lasts
+  const double Chip_Break_Max = .2;  // most of the revs a break can take, the feed between runs up to 1.25 times faster
+
 //----Position Variables----//
   double CrossZ;
   double LeadY;
@@ -100,6 +233,9 @@ double Refresh_Rate = 200000;
     int Enc2_New_Pos = 0;
     int Enc2_dir = 0;               // -1=cw 1=ccw 0=no movement
   const int  Enc_Button = 24;   //pin number
+  int Enc2_Button_Down = 0;                             // button state Enc2_Button_Edge() last took
+  unsigned long Enc2_Button_Time = 0;                   // millis() of the last edge
+  const unsigned long Button_Debounce = 50;             // ms
 
 //---- Pins ----//
   const int EncA = 7;               // encoder channel A pin              
@@ -111,6 +247,10 @@ double Refresh_Rate = 200000;
   const int Stepper_Enable = 2;     // Leadscrew Stepper Enable pin       
   const int SDA_Pin = 18;           // I2C SDA Pin
   const int SCL_Pin = 19;           // I2C SCL Pin
+  const int LeadEncA = 0;           // optional leadscrew encoder, any XBAR capable pin works with QuadEncoder
+  const int LeadEncB = 1;
+  const int CrossEncA = 30;         // optional cross slide encoder
+  const int CrossEncB = 31;
   //const byte SDA1_Pin = 17;       // I2C SDA1 Pin
   //const byte SCL1_Pin = 16;       // I2C SCL1 Pin
 
@@ -129,6 +269,25 @@ double Refresh_Rate = 200000;
 
   QuadEncoder spindle(1, EncA, EncB);
 
+//----Axis Encoders----//
+  // Optional encoders on the leadscrew and cross slide, counted by the spare hardware quadrature channels.
+  // A stalled stepper slips whole electrical cycles (4 full steps), so anything less is taken as normal lag
+  // and anything more is corrected a whole number of cycles at a time, see Axis_Encoders.h
+  const int Lead_Encoder_Fitted = 0;                    // 1 = encoder on LeadEncA/LeadEncB
+  const int Cross_Encoder_Fitted = 0;                   // 1 = encoder on CrossEncA/CrossEncB
+  const double Lead_Encoder_CPR = 4000;                 // encoder counts per leadscrew rev, include any gear ratios
+  const double Cross_Encoder_CPR = 4000;                // encoder counts per cross slide screw rev
+  const int Lead_Encoder_Reverse = 0;                   // 1 = encoder counts down when the leadscrew steps up
+  const int Cross_Encoder_Reverse = 0;
+  const long Lead_Slip_Cycle = LeadSPR / 50;            // steps in one electrical cycle of a 200 step motor
+  const long Cross_Slip_Cycle = CrossSPR / 50;
+  QuadEncoder Lead_Encoder(2, LeadEncA, LeadEncB);
+  QuadEncoder Cross_Encoder(3, CrossEncA, CrossEncB);
+  long Lead_Encoder_Offset = 0;                         // steps at encoder count zero
+  long Cross_Encoder_Offset = 0;
+  uint16_t Lead_Slips = 0;                              // corrections made since power up
+  uint16_t Cross_Slips = 0;
+
 //----Timer Initialization----//
   IntervalTimer RPM_Check;                              // Interval timer tp check RPM of the spindle
   PeriodicTimer Refresh_Rate_Timer(TCK);                // Software Timer to call the 7seg display routine
@@ -139,33 +298,378 @@ double Refresh_Rate = 200000;
   Adafruit_SSD1327 Feed_Display(128, 128, &Wire, OLED_RESET, 1000000);
   Adafruit_SSD1327 Graph_Display(128, 128, &Wire, OLED_RESET, 1000000);
 
+//----Step Output----//
+  // Every step pin pulse comes from Step_Tick() (Step_Output.h).  AccelStepper and the synchronized step generator only
+  // queue logical steps, the output stage adds the steps the position model never sees: backlash take-up and pitch error compensation
+  IntervalTimer Step_Timer;
+  const double Step_Tick_US = 5;                        // output tick, a pulse is high one tick and low at least one, 100k steps/sec max
+  const long Step_Credit = 1000000;                     // credit one rate limited step costs, an axis earns speed * Step_Tick_US per tick
+  struct Axis_Output {
+    int Step_Pin;
+    int Dir_Pin;
+    volatile long Queue;                                // logical steps waiting to go out, + = up
+    volatile int Dir_Level;                             // level on the direction pin, -1 = not set yet
+    volatile int High;                                  // step pin raised last tick
+    long Backlash;                                      // take-up steps after a reversal
+    volatile long Backlash_Left;                        // take-up steps still to send
+    long Takeup_Rate;                                   // credit per tick for take-up and compensation steps
+    volatile long Takeup_Credit;
+    volatile long Extra;                                // steps sent that the position model does not count, motor = logical + Extra
+    volatile long Position;                             // logical steps sent since power up, the position the pitch table is read at
+    const long *Comp_Table;                             // pitch correction in steps at each table point
+    int Comp_Points;
+    long Comp_Spacing;                                  // steps between table points
+    long Comp_Start;                                    // Position of the first table point
+    volatile int Comp_Index;                            // table segment Position is in
+    volatile long Comp_Offset;                          // Position - start of the segment, outside 0 to Comp_Spacing past either end of the table
+    volatile long Comp_Acc;                             // interpolation remainder, 0 to Comp_Spacing - 1
+    volatile long Comp_Value;                           // correction at Position
+    volatile long Comp_Owed;                            // correction steps still to send, + = up
+  };
+  // every field set, in order: pins, Queue, Dir_Level, High, backlash (4), Extra, Position, pitch table (9), Comp_Begin() fills the table
+  Axis_Output Lead_Out = {LeadStp, LeadDir, 0, -1, 0, 0, 0, 0, 0, 0, 0, NULL, 0, 0, 0, 0, 0, 0, 0, 0};
+  Axis_Output Cross_Out = {CrossStp, CrossDir, 0, -1, 0, 0, 0, 0, 0, 0, 0, NULL, 0, 0, 0, 0, 0, 0, 0, 0};
+  int Lead_Backlash = 0;                                // leadscrew backlash in steps
+  int Cross_Backlash = 0;                               // cross slide backlash in steps
+  double Backlash_Rate = 20000;                         // take-up steps/sec
+
+  //----Pitch Error Compensation----//
+    // Correction in steps at evenly spaced points along each screw, measured against an indicator or scale from where the
+    // axis was at power up.  Between points the correction is interpolated, past the ends it holds the end value.  A point
+    // where the carriage comes up .0004" short of the commanded travel gets +.0004 * LeadSPR * LeadScrew_TPI = +20 steps
+    const int Lead_Comp_Points = 13;
+    const long Lead_Comp_Spacing = LeadSPR * LeadScrew_TPI;               // one inch of carriage travel
+    const long Lead_Comp_Start = -(Lead_Comp_Points - 1) * Lead_Comp_Spacing;   // table runs from 12" toward the headstock up to the power up position
+    const long Lead_Comp_Table[Lead_Comp_Points] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    const int Cross_Comp_Points = 7;
+    const long Cross_Comp_Spacing = CrossSPR;                             // one cross slide screw rev
+    const long Cross_Comp_Start = -(Cross_Comp_Points - 1) * Cross_Comp_Spacing;
+    const long Cross_Comp_Table[Cross_Comp_Points] = {0, 0, 0, 0, 0, 0, 0};
+
+  // AccelStepper that hands its steps to an Axis_Output instead of driving the pins itself
+  class ELS_Stepper : public AccelStepper {
+    public:
+      ELS_Stepper(Axis_Output *Output) : AccelStepper(AccelStepper::DRIVER, Output->Step_Pin, Output->Dir_Pin), Out(Output) {}
+    protected:
+      void step(long /* step */) override {                // AccelStepper's step phase is for driving pins, not used here
+        uint32_t Primask;                                   // run() can be called with interrupts already off, leave them that way
+        __asm__ volatile("mrs %0, primask\n" : "=r" (Primask)::);
+        __disable_irq();
+        if (_direction == DIRECTION_CW) {Out->Queue++;} else {Out->Queue--;}
+        if (Primask == 0) {__enable_irq();}
+      }
+    private:
+      Axis_Output *Out;
+  };
+
 //----Stepper Initilization----//
-  AccelStepper LeadScrew(AccelStepper::DRIVER, LeadStp, LeadDir);
-  AccelStepper CrossSlide(AccelStepper::DRIVER, CrossStp, CrossDir);
+  ELS_Stepper LeadScrew(&Lead_Out);
+  ELS_Stepper CrossSlide(&Cross_Out);
   MultiStepper ZY_Steppers;             // Sets up a multistepper enviroment for coordinated movement of the leadscrew and crossslide
-  int Step_Pulse_Width = 5;
 
 //----Menu Strings----//
   //----Direction Options----//
     const int Direction_Array_Size = 2;      //total amount of mode options
-    int Direction_Array_Pos = 0;
+    int Direction_Array_Pos = 0;             // way Auto Thread cuts, 0 = toward the headstock, 1 = toward the tailstock
     const String Direction_Array[Direction_Array_Size] = {"Forward", "Reverse"};
+  //----Thread Hand Options----//
+    const int Hand_Array_Size = 2;
+    int Thread_Hand = 0;                     // 0 = right hand, 1 = left hand, for Thread and Auto Thread
+    const String Hand_Array[Hand_Array_Size] = {"Right", "Left"};
   //----Mode Options----//
-    const int Mode_Array_Size = 8;      //total amount of mode options
+    const int Mode_Array_Size = 15;      //total amount of mode options
     int Mode_Array_Pos = 0;
-    const String Mode_Array[Mode_Array_Size] = {"Feed", "Thread", "A-Thread", "A-Turn", "Manual Z", "Manual X", "Radius", "Chamfer"};
+    const String Mode_Array[Mode_Array_Size] = {"Feed", "Thread", "A-Thread", "A-Turn", "Manual Z", "Manual X", "Radius", "Chamfer", "G-Code", "Taper", "Ball", "Face", "Part", "Groove", "Polygon"};
   //----Measurement Options----//
     const int Measure_Array_Size = 2;      //total amount of mode options
     int Measure_Array_Pos = 0;
     const String Measure_Array[Measure_Array_Size] = {"In", "mm"};
   //----TPI Options----//
-    const int TPI_Array_Size = 38;
-    int TPI_Array_Pos = 17;
-    const int TPI_Array[TPI_Array_Size] = {1,2,4,5,6,7,8,9,10,11,12,13,14,16,18,19,20,22,24,26,27,28,30,32,34,36,38,40,42,44,46,48,50,54,56,60,72,80};
+    int TPI_Array_Pos = 17;              // TPI_Array is in Sync_Ratio.h
   //----Pitch Options----//
-    const int Pitch_Array_Size = 37;
-    int Pitch_Array_Pos = 5;
-    const float Pitch_Array[Pitch_Array_Size] = {.2, .3, .4, .5, .6, .7, .75, .8, .9, 1, 1.1, 1.25, 1.3, 1.4, 1.5, 1.75, 2, 2.25, 2.5, 2.75, 3, 3.5, 4, 4.5, 5, 6, 7, 8, 9, 10, 12, 14, 16, 18, 20, 22, 24};
+    int Pitch_Array_Pos = 5;             // Pitch_Array is in Sync_Ratio.h
+  //----Pipe Thread Options----//
+    // tapered 1:16 on the diameter.  NPT from ASME B1.20.1, inch.  BSPT (R) from ISO 7-1, mm
+    const int Taper_Thread_Array_Size = 3;
+    const String Taper_Thread_Array[Taper_Thread_Array_Size] = {"Straight", "NPT", "BSPT"};
+    const int Pipe_Array_Size = 13;
+    int Pipe_Array_Pos = 4;
+    const String Pipe_Array[Pipe_Array_Size] = {"1/16", "1/8", "1/4", "3/8", "1/2", "3/4", "1", "1-1/4", "1-1/2", "2", "2-1/2", "3", "4"};
+    const double NPT_TPI[Pipe_Array_Size] = {27, 27, 18, 18, 14, 14, 11.5, 11.5, 11.5, 11.5, 8, 8, 8};
+    const double NPT_E0[Pipe_Array_Size] = {.27118, .36351, .47739, .61201, .75843, .96768, 1.21363, 1.55713, 1.79609, 2.26902, 2.71953, 3.34062, 4.33438};   // pitch dia at the small end
+    const double NPT_L2[Pipe_Array_Size] = {.2611, .2639, .4018, .4078, .5337, .5457, .6828, .7068, .7235, .7565, 1.1375, 1.2, 1.3};                     // effective thread length
+    const int BSPT_TPI[Pipe_Array_Size] = {28, 28, 19, 19, 14, 14, 11, 11, 11, 11, 11, 11, 11};
+    const double BSPT_Gauge_Dia[Pipe_Array_Size] = {7.723, 9.728, 13.157, 16.662, 20.955, 26.441, 33.249, 41.91, 47.803, 59.614, 75.184, 87.884, 113.03};   // major dia at the gauge plane
+    const double BSPT_Gauge_Length[Pipe_Array_Size] = {4, 4, 6, 6.4, 8.2, 9.5, 10.4, 12.7, 12.7, 15.9, 17.5, 20.6, 25.4};                             // small end to the gauge plane
+    const double BSPT_Length[Pipe_Array_Size] = {6.5, 6.5, 9.7, 10.1, 13.2, 14.5, 16.8, 19.1, 19.1, 23.4, 26.7, 29.8, 35.8};                         // useful thread length
+
+//----Following Error----//
+  // error in steps between where the spindle count says an axis should be and where the steps have put it, see Follow.h
+  double in_Follow_Limit = .003;                        // feed hold and retract past this error
+  double mm_Follow_Limit = .08;
+  double in_Follow_Retract = .05;                       // cross slide pull back on a trip
+  double mm_Follow_Retract = 1.25;
+  volatile long Follow_Limit_Steps = 0x7FFFFFFF;
+  volatile long Follow_Error = 0;                       // latest error, target minus actual steps
+  volatile long Follow_Peak = 0;                        // largest error of the current cut
+  volatile int Follow_Tripped = 0;                      // set the moment the limit is crossed
+  int Follow_Hold = 0;                                  // 1 = feed held and retracting, cleared once the spindle stops
+
+//----Soft Stops----//
+  // travel limits of each axis in logical steps, moved with the axis by Soft_Stop_Shift() whenever its position is redefined,
+  // synchronized moves slow down ahead of them and stop on them, see Soft_Stop.h
+  struct Soft_Stop {
+    volatile int Min_On;                                // 1 = the axis stops at Min
+    volatile int Max_On;
+    volatile long Min;
+    volatile long Max;
+    volatile long Span_Plan;                            // steps the axis takes to stop at the speed now, from Soft_Stop_Plan()
+    long Span;                                          // span Sync_Step() is using, it only takes Span_Plan up clear of both stops
+  };
+  Soft_Stop Z_Soft = {0, 0, 0, 0, 1, 1};
+  Soft_Stop X_Soft = {0, 0, 0, 0, 1, 1};
+  const double Soft_Stop_Margin = 1.25;                 // spindle speed up the slow down is planned to allow for
+
+//----Saved Settings----//
+  Settings_Payload Settings_Saved;                      // settings as they are in the store
+  Settings_Payload Settings_Pending;                    // last edit seen, saved once it settles
+  int Settings_Changed = 0;                             // 1 = settings differ from the store and are waiting to settle
+  unsigned long Settings_Changed_Time = 0;
+  const unsigned long Settings_Settle_MS = 5000;        // settings must be left alone this long before they are written
+
+//----Job Library----//
+  // Jobs are fixed size records in a file on the program flash, Job_Slots per mode, addressed by mode and slot
+  const int Job_Slots = 32;                             // jobs per mode
+  const int Job_Name_Size = 16;
+  const uint8_t Job_Used = 0xA5;                        // marks a slot that holds a job
+  const unsigned long Job_Hold_Time = 1000;             // ms the Enc2 button is held on the job page to save instead of load
+  const uint32_t Job_FS_Size = 256 * 1024;              // program flash set aside for the job file
+  const char *Job_File = "joblib.bin";                  // name stays the same from now on, each record carries its version
+  const char *Job_File_Old[2] = {"jobs.bin", "jobs2.bin"};   // libraries from before the records had a version
+  const uint32_t Job_Record_Size = 128;                 // bytes each slot takes in the file, room for Settings_Payload to grow
+  struct __attribute__((packed)) Job_Record {
+    uint8_t Used;
+    uint8_t Version;                                    // Settings_Version the job was saved with
+    uint16_t Size;                                      // sizeof(Settings_Payload) the job was saved with
+    char Name[Job_Name_Size];
+    Settings_Payload Data;                              // same parameter set as the saved settings
+    uint16_t CRC;
+  };
+  static_assert(sizeof(Job_Record) <= Job_Record_Size, "Job_Record has outgrown its slot, raise Job_Record_Size");
+  LittleFS_Program Job_FS;
+  int Job_FS_Ready = 0;
+  int Job_Pos = 0;                                      // job slot shown on the job page
+  int Job_Press = 0;                                    // 1 = Enc2 went down on the job page and has not saved yet
+  Job_Record Job_Current;
+
+//----Serial Protocol----//
+  // every setting the host can read or write, indexed by Protocol_Setting_ID.  Real points at a double setting, Whole at an int one
+  struct Protocol_Setting {
+    double *Real;
+    int *Whole;
+    double Min;
+    double Max;
+  };
+  const Protocol_Setting Protocol_Settings[Setting_Count] = {
+    {&In_FeedRate, NULL, .001, 1},            {&mm_FeedRate, NULL, .01, 25},
+    {NULL, &Metric, 0, 1},                    {NULL, &Thread_Mode, 0, 1},
+    {NULL, &TPI_Array_Pos, 0, TPI_Array_Size - 1}, {NULL, &Pitch_Array_Pos, 0, Pitch_Array_Size - 1},
+    {NULL, &Mode_Array_Pos, 0, Mode_Array_Size - 1},
+    {&in_Outside_Diameter, NULL, .001, 100},  {&mm_Outside_Diameter, NULL, .01, 2500},
+    {&in_Final_Diameter, NULL, .001, 100},    {&mm_Final_Diameter, NULL, .01, 2500},
+    {&in_DOC, NULL, .001, 1},                 {&mm_DOC, NULL, .01, 25},
+    {&in_length_of_cut, NULL, .001, 100},     {&mm_length_of_cut, NULL, .01, 2500},
+    {NULL, &Radius_type, 0, 3},               {&in_Radius, NULL, .001, 10},
+    {&mm_Radius, NULL, .01, 250},             {NULL, &Radius_Steps, 1, Radius_Max_steps},
+    {&final_pass_in, NULL, 0, 1},             {&final_pass_mm, NULL, 0, 25},
+    {&in_Follow_Limit, NULL, .0001, 1},       {&mm_Follow_Limit, NULL, .001, 25},
+    {&in_Follow_Retract, NULL, 0, 1},         {&mm_Follow_Retract, NULL, 0, 25},
+    {NULL, &Lead_Backlash, 0, 2000},          {NULL, &Cross_Backlash, 0, 2000},
+    {&Backlash_Rate, NULL, 100, 100000},
+    {NULL, &Taper_type, 0, 1},                {&Taper_Angle, NULL, -45, 45},
+    {NULL, &Chamfer_type, 0, 3},              {&in_Chamfer_Size, NULL, .001, 2},
+    {&mm_Chamfer_Size, NULL, .01, 50},        {&Chamfer_Angle, NULL, 1, 89},
+    {NULL, &Ball_type, 0, 1},                 {&in_Ball_Diameter, NULL, .01, 100},
+    {&mm_Ball_Diameter, NULL, .1, 2500},      {&in_Ball_Neck, NULL, 0, 100},
+    {&mm_Ball_Neck, NULL, 0, 2500},          {NULL, &Face_type, 0, 1},
+    {&in_Face_Rate, NULL, .01, 100},          {&mm_Face_Rate, NULL, .1, 2500},
+    {&in_Face_Depth, NULL, .001, 10},         {&mm_Face_Depth, NULL, .01, 250},
+    {&in_Part_Diameter, NULL, 0, 100},        {&mm_Part_Diameter, NULL, 0, 2500},
+    {NULL, &Part_Peck_Revs, 0, 100},          {&in_Part_Retract, NULL, .001, 1},
+    {&mm_Part_Retract, NULL, .01, 25},        {NULL, &Chip_Break, 0, 2},
+    {NULL, &Chip_Break_Revs, 1, 100},         {&Chip_Break_Degrees, NULL, 1, 180},
+    {&in_Groove_Position, NULL, 0, 100},      {&mm_Groove_Position, NULL, 0, 2500},
+    {&in_Groove_Width, NULL, .001, 10},       {&mm_Groove_Width, NULL, .01, 250},
+    {&in_Groove_Depth, NULL, .001, 10},       {&mm_Groove_Depth, NULL, .01, 250},
+    {&in_Groove_Tool, NULL, .001, 1},         {&mm_Groove_Tool, NULL, .01, 25},
+    {&Groove_Dwell, NULL, 0, 100},            {NULL, &Polygon_type, 0, 1},
+    {NULL, &Polygon_Sides, 3, 12},            {&in_Polygon_Size, NULL, .01, 100},
+    {&mm_Polygon_Size, NULL, .1, 2500},       {&in_Polygon_Offset, NULL, 0, 10},
+    {&mm_Polygon_Offset, NULL, 0, 250},       {&in_Polygon_Length, NULL, 0, 100},
+    {&mm_Polygon_Length, NULL, 0, 2500},      {&in_Thread_Stop, NULL, 0, 100},
+    {&mm_Thread_Stop, NULL, 0, 2500},         {NULL, &Thread_Starts, 1, Thread_Starts_Max},
+    {NULL, &Thread_Taper, 0, Taper_Thread_Array_Size - 1}, {NULL, &Pipe_Array_Pos, 0, Pipe_Array_Size - 1},
+    {NULL, &Thread_Hand, 0, Hand_Array_Size - 1}, {NULL, &Direction_Array_Pos, 0, Direction_Array_Size - 1},
+    {&Thread_Pull_Angle, NULL, 0, Thread_Pull_Angle_Max},
+  };
+  Protocol_Decoder Protocol_Rx;
+  const int Protocol_Rx_Budget = 64;                    // most received bytes decoded per loop() pass
+  uint8_t Protocol_Streams = 0;                         // telemetry streams the host subscribed to
+  uint16_t Protocol_Status_Period = 100;                // ms between Stream_Status samples
+  unsigned long Protocol_Status_Time = 0;
+  uint8_t Protocol_Tx_Seq = 0;                          // sequence number for frames the lathe sends on its own
+
+//----Motion Telemetry----//
+  // Telemetry_Sample() fills one block while loop() sends the other, a sample is dropped when both are waiting on USB
+  IntervalTimer Telemetry_Timer;
+  const double Telemetry_Period_US = 1000;              // 1 kHz
+  Motion_Sample Telemetry_Block[2][Motion_Block_Samples];
+  volatile int Telemetry_Fill = 0;                      // block being filled
+  volatile int Telemetry_Fill_Count = 0;
+  volatile int Telemetry_Full[2] = {0, 0};              // 1 = block is waiting to be sent
+  int Telemetry_Send = 0;                               // next block to send, blocks go out in the order they filled
+  volatile uint16_t Telemetry_Dropped = 0;              // samples dropped since the last block was sent
+
+//----Spindle Sync----//
+  // Sync_Step() queues steps for both axes from the spindle count while a synchronized move is active, see Sync.h
+  volatile int Sync_Active = 0;                         // 1 = a synchronized move owns the steppers, AccelStepper must leave them alone
+  volatile int Sync_Done = 0;                           // set when a synchronized move reaches its end
+  volatile long Sync_Z_Pos = 0;                         // leadscrew steps, handed back to LeadScrew when the move ends
+  volatile long Sync_X_Pos = 0;                         // cross slide steps
+  volatile long Sync_Z_Target = 0;
+  volatile long Sync_X_Target = 0;
+  long long Sync_Num = 0;                               // dominant axis steps per spindle count = Sync_Num / Sync_Den
+  long long Sync_Den = 1;
+  volatile long long Sync_Acc = 0;
+  volatile int32_t Sync_Last_Count = 0;
+  volatile long Sync_Progress = 0;                      // dominant axis steps along the move, runs past either end while the spindle is outside it
+  volatile long Sync_Path = 0;                          // dominant axis steps the targets are along the move
+  long Sync_Ramp = 0;                                   // progress steps of lead in ramp at the start of the move, 0 = none
+  long Sync_Ramp_Lead = 0;                              // path steps the ramp covers, the targets are this far behind the progress after it
+  long Sync_Length = 0;                                 // dominant axis steps in the move
+  long Sync_Minor_Length = 0;
+  volatile long Sync_Minor_Err = 0;
+  int Sync_Major_Is_X = 0;
+  int Sync_Major_Dir = 1;
+  int Sync_Minor_Dir = 1;
+  long Sync_Z_Rate = 0;                                 // step credit earned per tick, LeadSpeed * Step_Tick_US
+  long Sync_X_Rate = 0;
+  volatile long Sync_Z_Credit = 0;
+  volatile long Sync_X_Credit = 0;
+  volatile int Sync_Endless = 0;                        // 1 = no end point, Feed mode's lock to the spindle
+  long long Sync_Acc_Num = 0;                           // accumulator step per count and per dominant axis step, Sync_Num / Sync_Den
+  long long Sync_Acc_Den = 1;                           // scaled up while chip breaking
+  int Sync_Break_Type = 0;                              // set up by Sync_Start() for the move running
+  long Sync_Break_Window = 0;                           // spindle counts from one break to the next
+  long Sync_Break_Cut = 0;                              // counts of feed before the break
+  volatile long Sync_Break_Phase = 0;                   // counts into the window
+  volatile int Sync_Profile_On = 0;                     // 1 = the cross slide target follows Sync_Profile by spindle angle, set before Sync_Start()
+  const long *Sync_Profile = NULL;                      // cross slide steps at each spindle count, Sync_Profile_Length of them
+  long Sync_Profile_Length = 1;
+  int32_t Sync_Profile_Start = 0;                       // spindle count the profile starts at, angle zero
+  int Sync_Phase = 0;                                   // Phase the move was started with, 1 = from spindle angle zero
+  volatile int Sync_Phase_Wait = 0;                     // 1 = an endless lock has not reached angle zero yet
+  volatile int Sync_Z_Stop_On = 0;                      // 1 = the leadscrew never steps past Sync_Z_Stop in Sync_Z_Stop_Dir
+  volatile long Sync_Z_Stop = 0;
+  int Sync_Z_Stop_Dir = 1;
+  volatile int Sync_Pull_On = 0;                        // 1 = the cross slide pulls out once the leadscrew target passes Sync_Pull_Z in Sync_Pull_Dir
+  volatile long Sync_Pull_Z = 0;
+  int Sync_Pull_Dir = 1;
+  long Sync_Pull_Run = 1;                               // leadscrew steps past Sync_Pull_Z the pull out takes
+  long Sync_Pull_Rise = 0;                              // cross slide steps out at the end of the pull out, it holds there after
+  const long Sync_Reach_All = 0x7FFFFFFF;               // no end to the reach of a move
+  long Sync_Z_Low = 0;                                  // lowest and highest target the move running can give each axis, from Sync_Start() and Sync_Pull()
+  long Sync_Z_High = 0;
+  long Sync_X_Low = 0;
+  long Sync_X_High = 0;
+
+//----Motion Planner----//
+  // queue of straight moves in steps, filled by the G-code interpreter and ran in order by Planner_Run()
+  const uint8_t Seg_Rapid = 0;                          // both axes at full speed through ZY_Steppers
+  const uint8_t Seg_Feed = 1;                           // straight line at Rate path steps/sec through ZY_Steppers
+  const uint8_t Seg_Sync = 2;                           // straight line locked to the spindle by Sync_Step()
+  const uint8_t Seg_Accel = 3;                          // rapid with each axis on its own acceleration ramp, stepped by Planner_Run().
+                                                        // Not straight, and only for modes that do not also run ZY_Steppers
+  const uint8_t Seg_Dwell = 4;                          // axes stay put for Num spindle counts
+  struct Motion_Segment {
+    uint8_t Type;
+    uint8_t Phase;                                      // Seg_Sync: 1 = start on spindle angle zero (threads)
+    long Angle;                                         // Seg_Sync with Phase 1: spindle counts past angle zero to start on instead
+    long Ramp;                                          // Seg_Sync with Phase 1: spindle counts of lead in ramp before the start angle
+    long Pull_Run;                                      // Seg_Sync: leadscrew steps before Z the cross slide starts pulling out, 0 = no pull out
+    long Pull_Rise;                                     // Seg_Sync: cross slide steps out it has pulled by Z
+    long Z;                                             // end position in steps
+    long X;
+    double Rate;                                        // Seg_Feed: steps/sec along the path
+    long long Num;                                      // Seg_Sync: dominant axis steps per spindle count = Num / Den
+    long long Den;
+  };
+  const int Planner_Size = 64;                          // segments
+  Motion_Segment Planner_Queue[Planner_Size];
+  int Planner_Head = 0;                                 // next segment to run
+  int Planner_Tail = 0;                                 // next free place
+  Motion_Segment Planner_Current;
+  int Planner_Busy = 0;                                 // 1 = Planner_Current is running
+  int32_t Planner_Dwell_Start = 0;                      // spindle count when a Seg_Dwell started
+  int Planner_Hold = 1;                                 // 1 = queue is filled but not ran, released by the start cycle command
+
+//----G-Code----//
+  const int GCode_Text_Size = 512;                      // received G-code waiting to be parsed
+  char GCode_Text[GCode_Text_Size];
+  int GCode_Text_Head = 0;
+  int GCode_Text_Tail = 0;
+  const int GCode_Line_Size = 96;
+  char GCode_Line[GCode_Line_Size];
+  int GCode_Line_Length = 0;
+  int GCode_Line_Overflow = 0;
+  long GCode_Lines = 0;                                 // lines parsed since the program started
+  int GCode_Error = 0;                                  // first parse or program error, 0 = none
+  long GCode_Error_Line = 0;
+  // modal state
+  int GCode_Motion = 0;                                 // 0, 1, 2, 3 or 33
+  int GCode_Metric = 0;                                 // G20 = 0  G21 = 1
+  int GCode_Relative = 0;                               // G90 = 0  G91 = 1
+  int GCode_Per_Rev = 0;                                // G94 = 0 (feed per minute)  G95 = 1 (feed per rev)
+  int GCode_Diameter = 0;                               // G8 = 0 (X is radius)  G7 = 1 (X is diameter)
+  double GCode_Feed = 0;
+  double GCode_Lead = 0;                                // G33 K, travel along Z per spindle rev
+  double GCode_Z = 0;                                   // programmed position, in program units
+  double GCode_X = 0;
+  long GCode_Origin_Z = 0;                              // steps at program zero, moved by G92
+  long GCode_Origin_X = 0;
+  // lines that expand into several segments are queued a piece at a time as room frees up
+  const int GCode_Expand_None = 0;
+  const int GCode_Expand_Arc = 1;
+  const int GCode_Expand_Thread = 2;
+  int GCode_Expand = GCode_Expand_None;
+  const int GCode_Arc_Max_Chords = 360;
+  const double GCode_Arc_Tolerance_in = .0002;          // largest gap between an arc and its chords
+  double GCode_Arc_Z, GCode_Arc_X;                      // center
+  double GCode_Arc_End_Z, GCode_Arc_End_X;              // last chord goes exactly to the programmed end
+  double GCode_Arc_Radius, GCode_Arc_Angle, GCode_Arc_Step;
+  int GCode_Arc_Left;                                   // chords still to queue
+  double GCode_Thread_Start_Z, GCode_Thread_End_Z, GCode_Thread_Drive_X, GCode_Thread_Peak_X;
+  double GCode_Thread_First, GCode_Thread_Depth, GCode_Thread_Degression;
+  int GCode_Thread_Pass, GCode_Thread_Spring, GCode_Thread_Done;
+
+//----Canned Cycles----//
+  // turning cycles plan one pass at a time into the motion planner, see Cycles.h.  Positions are relative to where the
+  // tool was when the cycle started, X + = away from the spindle axis
+  const int Cycle_Pass_Segments = 6;                    // most segments one pass pushes
+  int (*Cycle_Plan)(int Pass) = NULL;                   // pushes one pass, returns 0 once every pass is queued
+  int Cycle_Pass = 0;                                   // next pass to plan
+  int Cycle_Planned = 0;                                // 1 = every pass is queued
+  long Cycle_Origin_Z = 0;
+  long Cycle_Origin_X = 0;
+  long Cycle_Z = 0;                                     // end of the last segment pushed
+  long Cycle_X = 0;
+  double in_Cycle_Clear = .02;                          // tool clearance for rapids
+  double mm_Cycle_Clear = .5;
+  const int Cycle_List_Size = 1024;                     // segments a recorded cycle can hold
+  Motion_Segment Cycle_List[Cycle_List_Size];
+  int Cycle_List_Count = 0;
+  int Cycle_Recording = 0;                              // 1 = Cycle_Rapid() and Cycle_Feed() add to Cycle_List
+  int Cycle_Overflow = 0;                               // 1 = the last recording did not fit
 
 double Current_time = 0;
 double oldTime;
@@ -179,6 +683,8 @@ void Feed_Adjust();
 void Mode_Selection();
 void Mode_0_Feed_Controls();
 void Mode_1_Thread_Controls();
+void Mode_1_SubMenu_Controls();
+void Mode_1_SubMenu();
 void Mode_2_Auto_Thread_Controls();
 void Start_Feed_Display();
 void Feed();
@@ -190,6 +696,13 @@ void Refresh();
 void mm_Minor_Diameter();
 void in_Minor_Diameter();
 void Auto_Thread();
+long Thread_Steps(double Length);
+void Thread_Plan();
+int Thread_Pass(int Pass);
+long Thread_Surface(long Z);
+void Auto_Thread_Depth();
+double Pipe_TPI();
+void Pipe_Select();
 void Mode_2_SubMenu_Controls();
 void Turn_to_Diameter();
 void Mode_3_Auto_Turn_Controls();
@@ -201,6 +714,12 @@ void Spindle_Angle();
 void Manual_Z();
 void Manual_X();
 void Chamfer();
+void Chamfer_Plan();
+int Chamfer_Pass(int Pass);
+void Mode_7_Chamfer_Controls();
+void Mode_7_SubMenu_Controls();
+void Mode_7_SubMenu();
+int Cycle_Mode();
 void Auto_Feed_Clear();
 void Mode_6_SubMenu();
 void Auto_Radius();
@@ -218,3 +737,145 @@ void Set_Radius_Start_Postion();
 double ZY_Movement();
 void start_or_stop();
 void Radius_Update();
+long Thread_Pull_Run(long Rise);
+void Thread_Ratio(long long *Num, long long *Den);
+double Spindle_RPM_From_Counts(long long SpindleChange);
+void Settings_Restore();
+int Settings_Axes_Idle();
+void Settings_Update();
+void Settings_Pack(Settings_Payload *Data);
+void Settings_Real(double *Setting, float Value, int ID);
+void Settings_Unpack(const Settings_Payload *Data);
+void Radius_Plan();
+void Job_Begin();
+bool Job_Read(int Job_Mode, int Slot, Job_Record *Job);
+void Job_Write(int Job_Mode, int Slot, const Job_Record *Job);
+void Job_Store(int Slot);
+void Job_Recall(const Job_Record *Job);
+void Job_Name(char *Name);
+void Job_Page();
+void Job_Page_Controls();
+void Protocol_Update();
+void Protocol_Dispatch(const uint8_t *Frame, int Length);
+void Protocol_Setting_Changed(uint8_t ID);
+void Protocol_Send(uint8_t Type, uint8_t Seq, const uint8_t *Payload, int Size);
+void Protocol_Ack(uint8_t Type, uint8_t Seq);
+void Protocol_Nak(uint8_t Type, uint8_t Seq, uint8_t Reason);
+void Protocol_Send_Setting(uint8_t ID, uint8_t Seq);
+void Protocol_Send_Status();
+void Protocol_Send_GCode_Ack(uint8_t Seq);
+void Follow_Check(long Error);
+void Follow_Update();
+void Follow_Trip();
+void Follow_Display();
+long Soft_Stop_Shape(Soft_Stop *Stop, long Target, long Low, long High);
+void Soft_Stop_Begin(Soft_Stop *Stop, long From);
+void Soft_Stop_Limit(const Soft_Stop *Stop, long From, long To, long long *Num, long long *Den);
+void Soft_Stop_Line(const long Target[2], long End[2]);
+void Soft_Stop_Move(const long Target[2]);
+void Soft_Stop_Shift(Soft_Stop *Stop, long Shift);
+long Soft_Stop_Span(double Rate, double Accel);
+void Soft_Stop_Plan();
+void Soft_Stop_Controls(Soft_Stop *Stop, int Max, AccelStepper &Axis);
+void Soft_Stop_Display(const Soft_Stop *Stop, int Max, AccelStepper &Axis);
+void Axis_Encoder_Begin();
+void Axis_Encoder_Sync();
+void Axis_Encoder_Check();
+long Axis_Motor_Steps(long Logical, const Axis_Output *Out);
+long Axis_Encoder_Steps(QuadEncoder &Encoder, double SPR, double CPR);
+long Axis_Slip(long Error, long Cycle);
+void Axis_Correct(AccelStepper &Axis, long Correction);
+void Telemetry_Sample();
+void Telemetry_Update();
+void Telemetry_Reset();
+void Sync_Ratio(double Lead, int Lead_Metric, long long *Num, long long *Den);
+void Sync_Start(long Z, long X, long long Num, long long Den, int Phase, int Endless = 0, long Angle = 0, long Ramp = 0);
+long Sync_Ramp_Steps(long long Num, long long Den, long Counts);
+long Sync_Ramp_Counts(long long Num, long long Den, double RPM, double Accel);
+long Sync_Ramp_Lead_In(long long Num, long long Den, long Counts);
+void Sync_Pull(long Z, int Dir, long Run, long Rise);
+void Sync_Lock(long long Num, long long Den, int Phase = 0, int Dir = 1);
+void Sync_Stop();
+int Chip_Break_Plan(long *Window, long *Cut);
+long long Sync_Break_Rate(long Phase);
+void Sync_Step();
+void Step_Tick();
+void Output_Tick(Axis_Output *Out);
+void Output_Configure();
+void Output_Logical(Axis_Output *Out, int Step);
+void Comp_Begin(Axis_Output *Out, const long *Table, int Points, long Spacing, long Start);
+int Planner_Count();
+int Planner_Free();
+bool Planner_Push(const Motion_Segment *Segment);
+void Planner_Clear();
+void Planner_Run();
+void Planner_Start(const Motion_Segment *Segment);
+void G_Code();
+int GCode_Receive(const uint8_t *Text, int Size);
+int GCode_Text_Free();
+void GCode_Update();
+void GCode_Reset();
+int GCode_Execute(const GCode_Block *Block);
+long GCode_Steps(double Value);
+void GCode_Modal_Defaults();
+void GCode_Move(int Motion, double Z, double X);
+int GCode_Arc(int Motion, const GCode_Block *Block, double Z, double X);
+int GCode_Thread_Cycle(const GCode_Block *Block, double Z);
+void GCode_Expand_Next();
+long Cycle_Steps(double Length);
+Motion_Segment Cycle_Segment(uint8_t Type, long Z, long X);
+void Cycle_Rapid(long Z, long X);
+void Cycle_Feed(long Z, long X, double Feed, int Feed_X);
+void Cycle_Feed_Rate(long Z, long X, double Rate);
+void Cycle_Retract(long Z, long X);
+void Cycle_Thread(long Z, long X, long long Num, long long Den, long Angle, long Ramp, long Pull_Run, long Pull_Rise);
+void Cycle_Dwell(double Revs);
+void Cycle_Add(const Motion_Segment *Segment);
+int Cycle_Record(int (*Plan)(int Pass));
+int Cycle_List_Pass(int Pass);
+void Cycle_Begin(int (*Plan)(int Pass));
+void Cycle_Run();
+void Cycle_Stop();
+void Cycle_Start_Stop();
+void Cycle_Update();
+void Adjust_Value(double *Value, double Step, double Fast, double Faster, double Min);
+int Enc2_Button_Edge();
+void Taper();
+void Taper_Plan();
+int Taper_Pass(int Pass);
+void Mode_9_Taper_Controls();
+void Mode_9_SubMenu_Controls();
+void Mode_9_SubMenu();
+void Ball();
+void Ball_Plan();
+long Ball_Z(long R, int Back);
+int Ball_Pass(int Pass);
+void Mode_10_Ball_Controls();
+void Mode_10_SubMenu_Controls();
+void Mode_10_SubMenu();
+void Face();
+void Face_Plan();
+int Face_Pass(int Pass);
+void Mode_11_Face_Controls();
+void Mode_11_SubMenu_Controls();
+void Mode_11_SubMenu();
+void Parting();
+void Part_Plan();
+int Part_Pass(int Pass);
+void Mode_12_Part_Controls();
+void Mode_12_SubMenu_Controls();
+void Mode_12_SubMenu();
+void Groove();
+void Groove_Plan();
+int Groove_Pass(int Pass);
+void Mode_13_Groove_Controls();
+void Mode_13_SubMenu_Controls();
+void Mode_13_SubMenu();
+void Polygon();
+void Polygon_Build();
+void Polygon_Start();
+void Mode_14_Polygon_Controls();
+void Mode_14_SubMenu_Controls();
+void Mode_14_SubMenu();
+void Mode_0_SubMenu_Controls();
+void Mode_0_SubMenu();
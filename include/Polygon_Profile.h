@@ -0,0 +1,57 @@
+/*
+  Polygon and eccentric profiles - shared by the firmware and host side tools.
+
+  A profile is the cross slide position for every spindle count of one rev, in steps out from where the cut
+  starts.  Entry 0 is spindle angle zero, the middle of a flat or the low side of the eccentric.  Polygon mode
+  (src/Polygon.h) builds one and the synchronized step generator looks it up by the encoder count every tick.
+
+  No Arduino dependencies, the native tests run a profile at its reported top speed with this file.
+*/
+#ifndef POLYGON_PROFILE_H
+#define POLYGON_PROFILE_H
+
+#include <math.h>
+#include <stdlib.h>
+
+  const long Polygon_Slope_Span = 4;          // counts the steepest slope of a profile is taken over
+
+/**
+  @brief Works a shape out into a profile.  Returns 1 with the table filled in, 0 if there is no shape to cut
+  @param type   : 0 = polygon, 1 = eccentric
+  @param sides  : polygon sides, 3 or more
+  @param r      : half across the flats, or the eccentric radius, in steps
+  @param e      : eccentric offset in steps, less than r
+  @param cpr    : spindle counts per rev, the table has one entry for each
+  @param table  : cpr entries
+*/
+inline int Polygon_Profile(int type, int sides, double r, double e, long cpr, long *table) {
+  if (cpr < 1 || r <= 0 || (type == 0 && sides < 3) || (type == 1 && (e < 0 || e >= r))) {return 0;}
+  double pitch = 2 * M_PI / sides;
+  for (long count = 0; count < cpr; count++) {
+    double angle = 2 * M_PI * count / cpr;
+    double radius;
+    if (type == 0) {radius = r / cos(fmod(angle + pitch / 2, pitch) - pitch / 2) - r;}          // r = half across the flats
+    else {radius = sqrt(r * r - e * e * sin(angle) * sin(angle)) - e * cos(angle) - (r - e);}   // r = eccentric radius
+    table[count] = lround(radius);
+  }
+  return 1;
+}
+
+/**
+  @brief Fastest spindle speed the cross slide can follow a profile at, from its steepest Polygon_Slope_Span counts
+  @param table        : profile
+  @param cpr          : entries in the profile
+  @param cross_speed  : cross slide steps/sec
+  @return RPM, 9999 for a profile that never moves the cross slide
+*/
+inline double Polygon_Profile_Max_RPM(const long *table, long cpr, double cross_speed) {
+  long most = 0;
+  for (long count = 0; count < cpr; count++) {
+    long rise = labs(table[(count + Polygon_Slope_Span) % cpr] - table[count]);
+    if (rise > most) {most = rise;}
+  }
+  if (most == 0) {return 9999;}                               // round, the cross slide never moves
+  return cross_speed * 60 * Polygon_Slope_Span / ((double)most * cpr);
+}
+
+#endif
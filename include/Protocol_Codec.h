@@ -0,0 +1,204 @@
+/*
+  Serial protocol codec - shared by the firmware and host side tools.
+
+  A frame is   [type][seq][payload 0..Protocol_Max_Payload][crc16 lo][crc16 hi]
+  COBS encoded so it holds no zero bytes, then terminated with a single 0x00.  The CRC is
+  CRC-16/CCITT over type, seq and payload.  Multi byte values are little endian, reals are float32.
+
+  The decoder is fed one byte at a time and undoes the COBS encoding as the bytes arrive, so it
+  never buffers more than one decoded frame and never allocates.  A bad or oversized frame is
+  dropped at the next 0x00 and the decoder starts clean on the frame after it.
+
+  No Arduino dependencies, a PC program talks to the lathe by including this file.
+*/
+#ifndef PROTOCOL_CODEC_H
+#define PROTOCOL_CODEC_H
+
+#include <stdint.h>
+#include <string.h>
+#include "CRC16.h"
+
+//----Frame Sizes----//
+  const int Protocol_Max_Payload = 240;                                     // room for a block of motion samples
+  const int Protocol_Max_Frame = Protocol_Max_Payload + 4;                  // type, seq, payload, crc
+  const int Protocol_Max_Encoded = Protocol_Max_Frame + (Protocol_Max_Frame / 254) + 2;   // COBS overhead plus the 0x00
+
+//----Message Types----//
+  // host to lathe
+  const uint8_t Msg_Ping = 0x01;              // no payload, answered with Msg_Ack
+  const uint8_t Msg_Get_Setting = 0x02;       // [setting id]  answered with Msg_Setting
+  const uint8_t Msg_Set_Setting = 0x03;       // [setting id][float32]  answered with Msg_Setting
+  const uint8_t Msg_Start_Cycle = 0x04;       // no payload, starts the cycle of the selected mode
+  const uint8_t Msg_Stop_Cycle = 0x05;        // no payload, stops the cycle running, NAKed in Feed and Thread mode
+  const uint8_t Msg_Subscribe = 0x06;         // [stream mask][Stream_Status period ms u16]  mask 0 unsubscribes
+  const uint8_t Msg_GCode = 0x07;             // [G-code text]  answered with Msg_GCode_Ack, or Nak_Busy when there is no room yet
+  // lathe to host
+  const uint8_t Msg_Ack = 0x80;               // [type acknowledged]
+  const uint8_t Msg_Nak = 0x81;               // [type refused][Nak_ reason]
+  const uint8_t Msg_Setting = 0x82;           // [setting id][float32]
+  const uint8_t Msg_GCode_Ack = 0x83;         // [text space left u16][lines parsed u32][error u8][error line u32]
+  const uint8_t Msg_Status = 0x90;            // Stream_Status sample, see Protocol_Send_Status()
+  const uint8_t Msg_Motion = 0x91;            // [samples dropped u16][sample count u8][Motion_Sample ...]
+
+//----Nak Reasons----//
+  const uint8_t Nak_Unknown = 1;              // unknown message type
+  const uint8_t Nak_Length = 2;               // payload length wrong for the message
+  const uint8_t Nak_Setting = 3;              // unknown setting id or value out of range
+  const uint8_t Nak_Busy = 4;                 // not allowed right now (spindle turning, G-code buffer full), try again later
+  const uint8_t Nak_State = 5;                // the selected mode has no cycle to start or stop
+
+//----Telemetry Streams----//
+  const uint8_t Stream_Status = 0x01;         // spindle RPM, mode, cycle status and axis positions
+  const uint8_t Stream_Motion = 0x02;         // Motion_Sample every millisecond, sent in blocks
+
+//----Motion Samples----//
+  // wire layout of one Stream_Motion sample, little endian like the rest of the protocol
+  struct __attribute__((packed)) Motion_Sample {
+    uint32_t Time_US;                         // micros() when the sample was taken
+    int32_t Spindle_Count;                    // raw spindle encoder count
+    float Spindle_RPM;
+    int32_t Lead_Pos;                         // leadscrew steps output
+    int32_t Lead_Target;                      // leadscrew steps commanded
+    int32_t Cross_Pos;
+    int32_t Cross_Target;
+    int32_t Follow_Error;                     // steps the leadscrew is behind the spindle, 0 when nothing is locked to it
+    uint8_t Queue_Depth;                      // motion segments waiting
+    uint8_t Flags;                            // Motion_Sync
+  };
+  const uint8_t Motion_Sync = 0x01;           // a spindle synchronized move owns the steppers
+  const int Motion_Block_Samples = (Protocol_Max_Payload - 3) / sizeof(Motion_Sample);
+
+//----Setting IDs----//
+  // ids are part of the protocol, only ever add to the end
+  enum Protocol_Setting_ID {
+    Setting_In_FeedRate, Setting_mm_FeedRate, Setting_Metric, Setting_Thread_Mode,
+    Setting_TPI_Array_Pos, Setting_Pitch_Array_Pos, Setting_Mode_Array_Pos,
+    Setting_in_Outside_Diameter, Setting_mm_Outside_Diameter, Setting_in_Final_Diameter, Setting_mm_Final_Diameter,
+    Setting_in_DOC, Setting_mm_DOC, Setting_in_length_of_cut, Setting_mm_length_of_cut,
+    Setting_Radius_type, Setting_in_Radius, Setting_mm_Radius, Setting_Radius_Steps,
+    Setting_final_pass_in, Setting_final_pass_mm,
+    Setting_in_Follow_Limit, Setting_mm_Follow_Limit, Setting_in_Follow_Retract, Setting_mm_Follow_Retract,
+    Setting_Lead_Backlash, Setting_Cross_Backlash, Setting_Backlash_Rate,
+    Setting_Taper_type, Setting_Taper_Angle,
+    Setting_Chamfer_type, Setting_in_Chamfer_Size, Setting_mm_Chamfer_Size, Setting_Chamfer_Angle,
+    Setting_Ball_type, Setting_in_Ball_Diameter, Setting_mm_Ball_Diameter, Setting_in_Ball_Neck, Setting_mm_Ball_Neck,
+    Setting_Face_type, Setting_in_Face_Rate, Setting_mm_Face_Rate, Setting_in_Face_Depth, Setting_mm_Face_Depth,
+    Setting_in_Part_Diameter, Setting_mm_Part_Diameter, Setting_Part_Peck_Revs, Setting_in_Part_Retract, Setting_mm_Part_Retract,
+    Setting_Chip_Break, Setting_Chip_Break_Revs, Setting_Chip_Break_Degrees,
+    Setting_in_Groove_Position, Setting_mm_Groove_Position, Setting_in_Groove_Width, Setting_mm_Groove_Width,
+    Setting_in_Groove_Depth, Setting_mm_Groove_Depth, Setting_in_Groove_Tool, Setting_mm_Groove_Tool, Setting_Groove_Dwell,
+    Setting_Polygon_type, Setting_Polygon_Sides, Setting_in_Polygon_Size, Setting_mm_Polygon_Size,
+    Setting_in_Polygon_Offset, Setting_mm_Polygon_Offset, Setting_in_Polygon_Length, Setting_mm_Polygon_Length,
+    Setting_in_Thread_Stop, Setting_mm_Thread_Stop, Setting_Thread_Starts,
+    Setting_Thread_Taper, Setting_Pipe_Array_Pos, Setting_Thread_Hand, Setting_Direction_Array_Pos,
+    Setting_Thread_Pull_Angle,
+    Setting_Count
+  };
+
+//----Decoder----//
+  struct Protocol_Decoder {
+    uint8_t Frame[Protocol_Max_Frame];        // decoded frame, valid when Protocol_Decode_Byte returns > 0
+    int Length;
+    uint8_t Block_Code;                       // COBS code byte of the block being read
+    uint8_t Block_Left;                       // bytes left in the block, 0 = next byte is a code byte
+    uint8_t Overflow;                         // frame too long, drop it at the next 0x00
+  };
+
+/** @brief Clears a decoder so the next byte starts a new frame */
+inline void Protocol_Decoder_Reset(Protocol_Decoder *decoder) {
+  decoder->Length = 0;
+  decoder->Block_Code = 0;
+  decoder->Block_Left = 0;
+  decoder->Overflow = 0;
+}
+
+/**
+  @brief Feeds one received byte to the decoder.  Returns the frame length (type, seq and payload, CRC
+         removed) when a good frame ends on this byte, 0 while a frame is still arriving, -1 for a frame
+         that was dropped (bad CRC, too long or too short)
+  @param decoder  : decoder state
+  @param data     : received byte
+*/
+inline int Protocol_Decode_Byte(Protocol_Decoder *decoder, uint8_t data) {
+  if (data == 0) {                                        // end of frame
+    int length = decoder->Length;
+    bool good = decoder->Overflow == 0 && decoder->Block_Left == 0 && length >= 4;
+    if (good) {
+      uint16_t crc = decoder->Frame[length - 2] | (decoder->Frame[length - 1] << 8);
+      good = crc == CRC16(decoder->Frame, length - 2);
+    }
+    bool empty = length == 0 && decoder->Block_Code == 0;   // back to back 0x00 are just idle line
+    Protocol_Decoder_Reset(decoder);
+    if (good) {return length - 2;}
+    return empty ? 0 : -1;
+  }
+  if (decoder->Overflow) {return 0;}
+
+  if (decoder->Block_Left == 0) {                         // code byte, the previous block ended in an implied zero unless it was a full block
+    if (decoder->Block_Code != 0 && decoder->Block_Code != 0xFF) {
+      if (decoder->Length >= Protocol_Max_Frame) {decoder->Overflow = 1; return 0;}
+      decoder->Frame[decoder->Length++] = 0;
+    }
+    decoder->Block_Code = data;
+    decoder->Block_Left = data - 1;
+    return 0;
+  }
+
+  if (decoder->Length >= Protocol_Max_Frame) {decoder->Overflow = 1; return 0;}
+  decoder->Frame[decoder->Length++] = data;
+  decoder->Block_Left--;
+  return 0;
+}
+
+/**
+  @brief Builds a complete encoded frame, 0x00 terminator included.  Returns the number of bytes written
+         to out (at most Protocol_Max_Encoded), or 0 if the payload is too long
+  @param type     : message type
+  @param seq      : sequence number, answers echo the sequence of the request
+  @param payload  : message payload
+  @param length   : payload length
+  @param out      : Protocol_Max_Encoded bytes
+*/
+inline int Protocol_Encode(uint8_t type, uint8_t seq, const uint8_t *payload, int length, uint8_t *out) {
+  if (length < 0 || length > Protocol_Max_Payload) {return 0;}
+  uint8_t frame[Protocol_Max_Frame];
+  frame[0] = type;
+  frame[1] = seq;
+  if (length > 0) {memcpy(frame + 2, payload, length);}
+  uint16_t crc = CRC16(frame, length + 2);
+  frame[length + 2] = crc & 0xFF;
+  frame[length + 3] = crc >> 8;
+  int frame_length = length + 4;
+
+  int code_pos = 0;                                       // COBS: each block starts with the distance to the next zero
+  int out_pos = 1;
+  uint8_t code = 1;
+  for (int i = 0; i < frame_length; i++) {
+    if (frame[i] == 0) {
+      out[code_pos] = code;
+      code_pos = out_pos++;
+      code = 1;
+    } else {
+      out[out_pos++] = frame[i];
+      code++;
+      if (code == 0xFF) {
+        out[code_pos] = code;
+        code_pos = out_pos++;
+        code = 1;
+      }
+    }
+  }
+  out[code_pos] = code;
+  out[out_pos++] = 0;
+  return out_pos;
+}
+
+/** @brief Little endian helpers for building and reading payloads */
+inline void Protocol_Put_U16(uint8_t *at, uint16_t value) {at[0] = value & 0xFF; at[1] = value >> 8;}
+inline void Protocol_Put_U32(uint8_t *at, uint32_t value) {for (int i = 0; i < 4; i++) {at[i] = (value >> (8 * i)) & 0xFF;}}
+inline void Protocol_Put_Float(uint8_t *at, float value) {uint32_t bits; memcpy(&bits, &value, 4); Protocol_Put_U32(at, bits);}
+inline uint16_t Protocol_Get_U16(const uint8_t *at) {return at[0] | (at[1] << 8);}
+inline uint32_t Protocol_Get_U32(const uint8_t *at) {return at[0] | (at[1] << 8) | (at[2] << 16) | ((uint32_t)at[3] << 24);}
+inline float Protocol_Get_Float(const uint8_t *at) {uint32_t bits = Protocol_Get_U32(at); float value; memcpy(&value, &bits, 4); return value;}
+
+#endif
@@ -0,0 +1,167 @@
+/*
+  Settings store - versioned, CRC checked settings records kept in a ring of slots.
+
+  Each save goes to the slot after the newest one with the sequence number bumped, so the
+  writes are spread across the whole store instead of hammering the same bytes.  At boot the
+  slot headers are scanned for the newest sequence and only that record is CRC checked.
+
+  This file does not depend on Header.h so it can be built on a PC: on the Teensy the store is
+  the emulated EEPROM, anywhere else it is a plain file (Settings_Store_File) filled with 0xFF
+  like an erased EEPROM.
+*/
+#ifndef SETTINGS_STORE_H
+#define SETTINGS_STORE_H
+
+#include <stdint.h>
+#include <string.h>
+#include "CRC16.h"
+
+#ifdef ARDUINO
+  #include <EEPROM.h>
+#else
+  #include <stdio.h>
+#endif
+
+//----Record Layout----//
+  const uint8_t Settings_Magic = 0xE5;
+  const uint8_t Settings_Version = 2;           // bump when Settings_Payload changes, old records are then ignored
+  const int Settings_Store_Size = 1080;         // Teensy 4.0 emulated EEPROM size in bytes
+
+  struct __attribute__((packed)) Settings_Payload {
+    float In_FeedRate;
+    float mm_FeedRate;
+    float in_Radius;
+    float mm_Radius;
+    float in_DOC;
+    float mm_DOC;
+    float in_Outside_Diameter;
+    float mm_Outside_Diameter;
+    float in_Final_Diameter;
+    float mm_Final_Diameter;
+    float in_length_of_cut;
+    float mm_length_of_cut;
+    uint8_t TPI_Array_Pos;
+    uint8_t Pitch_Array_Pos;
+    uint8_t Mode_Array_Pos;
+    uint8_t Metric;
+    uint8_t Thread_Mode;
+    uint8_t Radius_type;
+    uint8_t Radius_Steps;
+    uint8_t Thread_Starts;
+    uint8_t Thread_Taper;
+    uint8_t Pipe_Array_Pos;
+    uint8_t Thread_Hand;
+    uint8_t Direction_Array_Pos;
+    float Thread_Pull_Angle;
+  };
+
+  struct __attribute__((packed)) Settings_Record {
+    uint8_t Magic;
+    uint8_t Version;
+    uint16_t Sequence;                          // newest record has the highest sequence, wraps around
+    Settings_Payload Data;
+    uint16_t CRC;                               // CRC-16/CCITT of everything above
+  };
+
+  const int Settings_Slots = Settings_Store_Size / sizeof(Settings_Record);
+
+//----Store State----//
+  int Settings_Slot = -1;                       // slot holding the newest record, -1 = nothing stored yet
+  uint16_t Settings_Sequence = 0;
+  const char *Settings_Store_File = "els_settings.bin";
+
+//----Backend----//
+#ifdef ARDUINO
+uint8_t Settings_Store_Read(int address) {return EEPROM.read(address);}
+void Settings_Store_Write(int address, uint8_t value) {EEPROM.update(address, value);}     // update skips bytes that already match
+#else
+uint8_t Settings_Store_Read(int address) {
+  uint8_t value = 0xFF;
+  FILE *store = fopen(Settings_Store_File, "rb");
+  if (store == NULL) {return value;}
+  if (fseek(store, address, SEEK_SET) == 0 && fread(&value, 1, 1, store) != 1) {value = 0xFF;}
+  fclose(store);
+  return value;
+}
+
+void Settings_Store_Write(int address, uint8_t value) {
+  FILE *store = fopen(Settings_Store_File, "r+b");
+  if (store == NULL) {                          // first use, create an erased store
+    store = fopen(Settings_Store_File, "w+b");
+    if (store == NULL) {return;}
+    for (int i = 0; i < Settings_Store_Size; i++) {fputc(0xFF, store);}
+  }
+  fseek(store, address, SEEK_SET);
+  fputc(value, store);
+  fclose(store);
+}
+#endif
+
+/** @brief Reads one slot, returns true if it holds a record of this version with a good CRC
+    @param slot    : slot number 0 to Settings_Slots-1
+    @param record  : record read from the slot
+*/
+bool Settings_Read_Slot(int slot, Settings_Record *record) {
+  uint8_t *bytes = (uint8_t *)record;
+  int address = slot * sizeof(Settings_Record);
+  for (unsigned int i = 0; i < sizeof(Settings_Record); i++) {bytes[i] = Settings_Store_Read(address + i);}
+  if (record->Magic != Settings_Magic || record->Version != Settings_Version) {return false;}
+  return record->CRC == CRC16(bytes, sizeof(Settings_Record) - sizeof(record->CRC));
+}
+
+/** @brief Finds the newest good record.  Returns false and leaves Data untouched if there is none
+    @param data  : where the stored settings are copied to
+*/
+bool Settings_Load(Settings_Payload *data) {
+  int newest = -1;
+  uint16_t newest_sequence = 0;
+  for (int slot = 0; slot < Settings_Slots; slot++) {          // only the headers are read here, the CRC is checked on the winner
+    int address = slot * sizeof(Settings_Record);
+    if (Settings_Store_Read(address) != Settings_Magic || Settings_Store_Read(address + 1) != Settings_Version) {continue;}
+    uint16_t sequence = Settings_Store_Read(address + 2) | (Settings_Store_Read(address + 3) << 8);
+    if (newest == -1 || (int16_t)(sequence - newest_sequence) > 0) {newest = slot; newest_sequence = sequence;}
+  }
+
+  Settings_Record record;
+  while (newest != -1) {
+    if (Settings_Read_Slot(newest, &record)) {
+      Settings_Slot = newest;
+      Settings_Sequence = record.Sequence;
+      memcpy(data, &record.Data, sizeof(Settings_Payload));
+      return true;
+    }
+    // newest record is damaged (power lost mid write), fall back to the one before it
+    int previous = -1;
+    uint16_t previous_sequence = 0;
+    for (int slot = 0; slot < Settings_Slots; slot++) {
+      if (slot == newest || !Settings_Read_Slot(slot, &record)) {continue;}
+      if ((int16_t)(record.Sequence - newest_sequence) >= 0) {continue;}
+      if (previous == -1 || (int16_t)(record.Sequence - previous_sequence) > 0) {previous = slot; previous_sequence = record.Sequence;}
+    }
+    newest = previous;
+    newest_sequence = previous_sequence;
+  }
+  return false;
+}
+
+/** @brief Writes the settings to the slot after the newest record
+    @param data  : settings to store
+*/
+void Settings_Save(const Settings_Payload *data) {
+  Settings_Record record;
+  record.Magic = Settings_Magic;
+  record.Version = Settings_Version;
+  record.Sequence = Settings_Sequence + 1;
+  memcpy(&record.Data, data, sizeof(Settings_Payload));
+  record.CRC = CRC16((const uint8_t *)&record, sizeof(Settings_Record) - sizeof(record.CRC));
+
+  int slot = (Settings_Slot + 1) % Settings_Slots;
+  const uint8_t *bytes = (const uint8_t *)&record;
+  int address = slot * sizeof(Settings_Record);
+  for (unsigned int i = 0; i < sizeof(Settings_Record); i++) {Settings_Store_Write(address + i, bytes[i]);}
+
+  Settings_Slot = slot;
+  Settings_Sequence = record.Sequence;
+}
+
+#endif
@@ -0,0 +1,55 @@
+/*
+  Spindle sync ratios - shared by the firmware and host side tools.
+
+  The synchronized step generator (src/Sync.h) adds Num to an accumulator for every spindle count and moves the
+  dominant axis one step every time the accumulator passes Den.  The ratios are worked out here as whole numbers,
+  so the lead is exact over any length of thread, along with the TPI and pitch tables the thread modes pick from.
+
+  No Arduino dependencies, the native tests check every table entry against its nominal lead with this file.
+*/
+#ifndef SYNC_RATIO_H
+#define SYNC_RATIO_H
+
+#include <math.h>
+
+//----TPI Options----//
+  const int TPI_Array_Size = 38;
+  const int TPI_Array[TPI_Array_Size] = {1,2,4,5,6,7,8,9,10,11,12,13,14,16,18,19,20,22,24,26,27,28,30,32,34,36,38,40,42,44,46,48,50,54,56,60,72,80};
+//----Pitch Options----//
+  const int Pitch_Array_Size = 37;
+  const float Pitch_Array[Pitch_Array_Size] = {.2, .3, .4, .5, .6, .7, .75, .8, .9, 1, 1.1, 1.25, 1.3, 1.4, 1.5, 1.75, 2, 2.25, 2.5, 2.75, 3, 3.5, 4, 4.5, 5, 6, 7, 8, 9, 10, 12, 14, 16, 18, 20, 22, 24};
+
+/**
+  @brief Dominant axis steps per spindle count for a lead.  The lead is scaled to an integer so any lead with up
+         to 6 decimals (inch) or 5 decimals (mm) is exact
+  @param lead            : dominant axis travel per spindle rev, in inch or mm
+  @param lead_metric     : 0 = lead is in inch, 1 = lead is in mm
+  @param steps_per_inch  : dominant axis steps per inch of travel
+  @param cpr             : spindle counts per rev
+  @param num             : steps per count numerator
+  @param den             : steps per count denominator
+*/
+inline void Sync_Lead_Ratio(double lead, int lead_metric, long long steps_per_inch, long long cpr, long long *num, long long *den) {
+  if (lead_metric == 0) {
+    *num = llround(lead * 1000000) * steps_per_inch;
+    *den = 1000000LL * cpr;
+  } else {
+    *num = llround(lead * 100000) * steps_per_inch;
+    *den = 2540000LL * cpr;                                   // 25.4 mm per inch, scaled with the lead
+  }
+}
+
+/**
+  @brief Dominant axis steps per spindle count for a whole number of threads per inch
+  @param tpi             : threads per inch
+  @param steps_per_inch  : dominant axis steps per inch of travel
+  @param cpr             : spindle counts per rev
+  @param num             : steps per count numerator
+  @param den             : steps per count denominator
+*/
+inline void Sync_TPI_Ratio(long long tpi, long long steps_per_inch, long long cpr, long long *num, long long *den) {
+  *num = steps_per_inch;
+  *den = tpi * cpr;
+}
+
+#endif
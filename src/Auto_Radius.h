@@ -1,13 +1,6 @@
 void Auto_Radius() {
   double final_pass;
-  if (Build_ZY == 0) {
-    R_Step_Angle = 1.5708 / Radius_Steps;   // 90 degrees in radians / radius step value
-    Build_ZY_Array();                       // Build coordinate array of the radius
-
-    //set feedrate (chip load?)
-
-    Set_Radius_Start_Postion();             // Set motor start position in Steps, mm/in conversion already done
-  }
+  if (Build_ZY == 0) {Radius_Plan();}
   
 //----Should work for all radius types----// 
   if (SpindleRPM != 0) {            //auto radius rough cut
@@ -17,14 +10,14 @@ void Auto_Radius() {
         if (Radius_type == 0 || Radius_type == 2) {final_pass = final_pass * -1;}          // Radius type 0 and 2 requres Z to move in the opposite direction 
         End_Pos[0] = Steps_per_Move(Radius_Z[Z_step]) + Steps_per_Move(final_pass);        // Leaves material for the final pass
         End_Pos[1] = Steps_per_Move(Radius_Y[Y_step]);
-        ZY_Steppers.moveTo(End_Pos);                   // Move to "End Position"  This is closest to the feature
+        Soft_Stop_Move(End_Pos);                       // Move to "End Position"  This is closest to the feature
         status = 1;
       }
       if (ZY_Movement() == 0 && status == 1) {  // this starts the cut in the opposite direction
         Z_step++;
         Y_step++;
         Start_Pos[1] = Steps_per_Move(Radius_Y[Y_step]);                            // Resets the Y position to be current, and not at 0.0
-        ZY_Steppers.moveTo(Start_Pos); 
+        Soft_Stop_Move(Start_Pos);
         status = 0;
       }
       if (Z_step == Radius_Steps) {
@@ -39,12 +32,22 @@ void Auto_Radius() {
     }
     if (ZY_Movement() == 0 && status == 4) {        // auto radius return to start positon
       Set_Radius_Start_Postion();
-      ZY_Steppers.moveTo(Start_Pos);
+      Soft_Stop_Move(Start_Pos);
       status = -1;                      // set status to -1 so no modes activate
     }
   }
 }
 
+/** @brief Plans the radius toolpath, ran by Auto_Radius() whenever the radius inputs change or a radius job is recalled */
+void Radius_Plan() {
+  R_Step_Angle = 1.5708 / Radius_Steps;   // 90 degrees in radians / radius step value
+  Build_ZY_Array();                       // Build coordinate array of the radius
+
+  //set feedrate (chip load?)
+
+  Set_Radius_Start_Postion();             // Set motor start position in Steps, mm/in conversion already done
+}
+
 /** @brief Builds two arrays: Radius_Z and Radius_Y
 */
 void Build_ZY_Array() {                       
@@ -61,7 +64,6 @@ void Build_ZY_Array() {
     for (int array_step = 0; array_step < Radius_Steps; array_step++) {
       Radius_Z[array_step] = modZ * Z_Coord(array_step);  // Z coordinate
       Radius_Y[array_step] = Y_Coord(array_step);  // Y coordinate
-      Serial.print(Radius_Z[array_step], DEC);Serial.print(", ");Serial.print(Radius_Y[array_step], DEC);Serial.print("    ");Serial.println(array_step);
     }
   }
 
@@ -69,7 +71,6 @@ void Build_ZY_Array() {
     for (int array_step = 0; array_step < Radius_Steps; array_step++) {
       Radius_Z[array_step] = modZ * Z_Coord(array_step);  // Z coordinate
       Radius_Y[array_step] = (modY * Y_Coord(array_step))-(Radius);  // Y coordinate
-      Serial.print(Radius_Z[array_step], DEC);Serial.print(" ");Serial.print(Radius_Y[array_step], DEC);Serial.print("    ");Serial.println(array_step);
     }
   }
 
@@ -111,6 +112,8 @@ void Cut_Pass() {       // This is only calculated while the Depth of Cut Submen
 
 /** @brief  sets the starting position of each radius type using the current tool position */
 void Set_Radius_Start_Postion(){
+  long Old_Z = LeadScrew.currentPosition();
+  long Old_X = CrossSlide.currentPosition();
   double Radius;
   if (Metric == 0) {Radius = in_Radius;} else {Radius = mm_Radius;}
   if (Radius_type == 0) {
@@ -130,6 +133,10 @@ void Set_Radius_Start_Postion(){
     CrossSlide.setCurrentPosition(-Steps_per_Move(Radius));
   }
 
+  Axis_Encoder_Sync();                              // positions were just redefined, the encoders follow
+  Soft_Stop_Shift(&Z_Soft, LeadScrew.currentPosition() - Old_Z);   // and so do the soft stops
+  Soft_Stop_Shift(&X_Soft, CrossSlide.currentPosition() - Old_X);
+
   Start_Pos[0] = LeadScrew.currentPosition();
   Start_Pos[1] = CrossSlide.currentPosition();
 }
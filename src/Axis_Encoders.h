@@ -0,0 +1,93 @@
+/** @brief Starts the axis encoders that are fitted and lines them up with the current step positions */
+void Axis_Encoder_Begin() {
+  if (Lead_Encoder_Fitted == 1) {
+    Lead_Encoder.setInitConfig();
+    Lead_Encoder.EncConfig.enableReverseDirection = Lead_Encoder_Reverse;
+    Lead_Encoder.init();
+  }
+  if (Cross_Encoder_Fitted == 1) {
+    Cross_Encoder.setInitConfig();
+    Cross_Encoder.EncConfig.enableReverseDirection = Cross_Encoder_Reverse;
+    Cross_Encoder.init();
+  }
+  Axis_Encoder_Sync();
+}
+
+/** @brief Encoder position in steps, offset not included
+    @param Encoder  : axis encoder
+    @param SPR      : axis steps per rev
+    @param CPR      : encoder counts per rev
+*/
+long Axis_Encoder_Steps(QuadEncoder &Encoder, double SPR, double CPR) {
+  return ((long long)Encoder.read() * (long long)SPR) / (long long)CPR;
+}
+
+/** @brief Step position the motor is really at, steps still in the output queue taken off and backlash take-up added
+    @param Logical  : position the step generator has reached
+    @param Out      : axis output stage
+*/
+long Axis_Motor_Steps(long Logical, const Axis_Output *Out) {
+  return Logical - Out->Queue + Out->Extra;
+}
+
+/** @brief Lines the encoders up with the step positions, called whenever a position is redefined rather than moved to */
+void Axis_Encoder_Sync() {
+  cli();
+  if (Lead_Encoder_Fitted == 1) {Lead_Encoder_Offset = Axis_Motor_Steps(LeadScrew.currentPosition(), &Lead_Out) - Axis_Encoder_Steps(Lead_Encoder, LeadSPR, Lead_Encoder_CPR);}
+  if (Cross_Encoder_Fitted == 1) {Cross_Encoder_Offset = Axis_Motor_Steps(CrossSlide.currentPosition(), &Cross_Out) - Axis_Encoder_Steps(Cross_Encoder, CrossSPR, Cross_Encoder_CPR);}
+  sei();
+}
+
+/** @brief Steps to take back off the step position, 0 while the error is inside half an electrical cycle
+    @param Error  : step position minus encoder position
+    @param Cycle  : steps per electrical cycle
+*/
+long Axis_Slip(long Error, long Cycle) {
+  if (labs(Error) <= Cycle / 2) {return 0;}
+  return lround((double)Error / Cycle) * Cycle;
+}
+
+/**
+  @brief Moves an AccelStepper position without touching its target or speed, so the steps that were lost are
+         stepped again by whatever is running the axis
+  @param Axis        : stepper to correct
+  @param Correction  : steps added to the position
+*/
+void Axis_Correct(AccelStepper &Axis, long Correction) {
+  long Target = Axis.targetPosition();
+  float Speed = Axis.speed();
+  Axis.setCurrentPosition(Axis.currentPosition() + Correction);
+  Axis.moveTo(Target);
+  Axis.setSpeed(Speed);
+}
+
+/**
+  @brief Compares each fitted encoder with the steps sent to its axis, ran once per loop() pass.  A synchronized
+         move has its step generator position corrected so Sync_Step() puts the lost steps back straight away
+*/
+void Axis_Encoder_Check() {
+  if (Lead_Encoder_Fitted == 1) {
+    cli();
+    int Synced = Sync_Active;                                   // the ISR can end the move, decide once
+    long Steps = Axis_Motor_Steps(Synced ? Sync_Z_Pos : LeadScrew.currentPosition(), &Lead_Out);
+    long Slip = Axis_Slip(Steps - Lead_Encoder_Offset - Axis_Encoder_Steps(Lead_Encoder, LeadSPR, Lead_Encoder_CPR), Lead_Slip_Cycle);
+    if (Slip != 0 && Synced == 1) {Sync_Z_Pos -= Slip;}
+    sei();
+    if (Slip != 0) {
+      Lead_Slips++;
+      if (Synced == 0) {Axis_Correct(LeadScrew, -Slip);}
+    }
+  }
+  if (Cross_Encoder_Fitted == 1) {
+    cli();
+    int Synced = Sync_Active;
+    long Steps = Axis_Motor_Steps(Synced ? Sync_X_Pos : CrossSlide.currentPosition(), &Cross_Out);
+    long Slip = Axis_Slip(Steps - Cross_Encoder_Offset - Axis_Encoder_Steps(Cross_Encoder, CrossSPR, Cross_Encoder_CPR), Cross_Slip_Cycle);
+    if (Slip != 0 && Synced == 1) {Sync_X_Pos -= Slip;}
+    sei();
+    if (Slip != 0) {
+      Cross_Slips++;
+      if (Synced == 0) {Axis_Correct(CrossSlide, -Slip);}
+    }
+  }
+}
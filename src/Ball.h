@@ -0,0 +1,112 @@
+/*
+  Ball turning, ran as a canned cycle (Cycles.h) recorded whole into Cycle_List when it starts.
+
+  Touch the tool off on the stock diameter at the end face.  The ball's tip is on the spindle axis at the face,
+  its center Ball_R in from the face.  A hemisphere ends at its equator against a shoulder of stock, a full
+  sphere carries on round the back of the ball down to a neck, left for parting off.  Roughing is stepped Z
+  passes, one level per depth of cut, each fed toward the headstock until it meets the ball grown by the finish
+  allowance.  Behind a full sphere the tool plunges at the far pole and feeds back toward the ball, which needs a
+  neutral tool.  The finishing pass is one continuous arc from the tip, chords no further than
+  GCode_Arc_Tolerance_in from the ball, fed at the feed per rev along the path.
+*/
+void Ball() {
+  if (status == 0) {
+    Ball_Plan();
+    Cycle_Begin(Cycle_List_Pass);
+    if (Cycle_Record(Ball_Pass) == 0) {Cycle_Stop();}
+  }
+  Cycle_Run();
+}
+
+/** @brief Works the ball out in steps from the inputs, ran when the cycle starts */
+void Ball_Plan() {
+  double Stock, Dia, Neck, DOC, Finish, Tolerance;
+  if (Metric == 0) {Stock = in_Outside_Diameter; Dia = in_Ball_Diameter; Neck = in_Ball_Neck; DOC = in_DOC; Finish = final_pass_in; Tolerance = GCode_Arc_Tolerance_in;}
+  else {Stock = mm_Outside_Diameter; Dia = mm_Ball_Diameter; Neck = mm_Ball_Neck; DOC = mm_DOC; Finish = final_pass_mm; Tolerance = GCode_Arc_Tolerance_in * 25.4;}
+  Ball_Stock = Cycle_Steps(Stock / 2);
+  Ball_R = Cycle_Steps(Dia / 2);
+  Ball_Neck_R = (Ball_type == 1) ? Cycle_Steps(Neck / 2) : Ball_R;   // a hemisphere stops at the equator
+  Ball_DOC = Cycle_Steps(DOC);
+  if (Ball_DOC < 1) {Ball_DOC = 1;}
+  Ball_Finish = Cycle_Steps(Finish);
+  Ball_Levels = (Ball_Stock + Ball_DOC - 1) / Ball_DOC;
+
+  double End = PI / 2;                                                // arc sweep from the tip
+  if (Ball_type == 1) {End = PI - asin((double)Ball_Neck_R / Ball_R);}
+  double Step_Max = End;
+  double Gap = Cycle_Steps(Tolerance);
+  if (Gap < Ball_R) {Step_Max = 2 * acos(1 - Gap / Ball_R);}
+  Ball_Chords = ceil(End / Step_Max);
+  Ball_Chords = constrain(Ball_Chords, 1, GCode_Arc_Max_Chords);
+  if (Ball_R <= 0 || Ball_R > Ball_Stock || Ball_Neck_R < 0 || Ball_Neck_R > Ball_R) {Ball_Levels = -1;}    // nothing to cut
+}
+
+/**
+  @brief Where the ball grown by the finish allowance crosses a roughing level
+  @param R     : level radius in steps
+  @param Back  : 0 = tailstock side of the ball, 1 = headstock side
+  @return Z in steps from the face
+*/
+long Ball_Z(long R, int Back) {
+  double Grown = Ball_R + Ball_Finish;
+  double Half = sqrt(fmax(Grown * Grown - (double)R * R, 0));
+  if (Back == 1) {return lround(-Ball_R - Half);}
+  if (Ball_type == 0 && R >= Ball_R) {return -Ball_R;}                // up against the shoulder
+  return lround(-Ball_R + Half);
+}
+
+/**
+  @brief Queues one pass of the ball cycle: a roughing level, the finishing arc, then the return to the start
+  @param Pass  : pass number from 0
+*/
+int Ball_Pass(int Pass) {
+  if (Ball_Levels < 0) {return 0;}
+  if (Pass > Ball_Levels + 1) {return 0;}
+  if (Pass == Ball_Levels + 1) {Cycle_Rapid(0, 0); return 1;}
+  long Clear = Cycle_Steps((Metric == 0) ? in_Cycle_Clear : mm_Cycle_Clear);
+  double Feed = (Metric == 0) ? In_FeedRate : mm_FeedRate;
+
+  if (Pass == Ball_Levels) {                                          // finishing arc, tip first
+    Cycle_Rapid(Clear, -Ball_Stock);
+    Cycle_Feed(0, -Ball_Stock, Feed, 0);
+    double End = PI / 2;
+    if (Ball_type == 1) {End = PI - asin((double)Ball_Neck_R / Ball_R);}
+    long Z = 0;
+    for (int Chord = 1; Chord <= Ball_Chords; Chord++) {
+      double Angle = End * Chord / Ball_Chords;
+      Z = lround(-Ball_R + Ball_R * cos(Angle));
+      Cycle_Feed(Z, lround(Ball_R * sin(Angle)) - Ball_Stock, Feed, 2);
+    }
+    Cycle_Rapid(Z, Clear);
+    Cycle_Rapid(Clear, Clear);
+    return 1;
+  }
+
+  long R = Ball_Stock - (Pass + 1) * Ball_DOC;                        // roughing level, radius from the spindle axis
+  if (R < 0) {R = 0;}
+  long X = R - Ball_Stock;
+  long Front = Ball_Z(R, 0);
+  if (Ball_type == 1 && R >= Ball_R + Ball_Finish) {Front = -2 * Ball_R;}   // clear of a full sphere, cut through to the far pole
+  if (Front < 0) {
+    Cycle_Rapid(Clear, X);
+    Cycle_Feed(Front, X, Feed, 0);
+    Cycle_Rapid(Front, Clear);
+    Cycle_Rapid(Clear, Clear);
+  }
+
+  long Above = Ball_Stock - Pass * Ball_DOC;                          // level cut before this one
+  long Floor = Ball_Neck_R + Ball_Finish;                             // the neck stops the headstock side levels
+  if (Ball_type == 1 && R < Ball_R + Ball_Finish && Above > Floor) {
+    if (R < Floor) {R = Floor; X = R - Ball_Stock;}
+    long Back = Ball_Z(R, 1);
+    if (Back > -2 * Ball_R) {
+      Cycle_Rapid(-2 * Ball_R, Clear);
+      Cycle_Rapid(-2 * Ball_R, Above - Ball_Stock);
+      Cycle_Feed(-2 * Ball_R, X, Feed, 1);                            // plunge at the far pole
+      Cycle_Feed(Back, X, Feed, 0);                                   // back toward the ball
+      Cycle_Rapid(Back, Clear);
+      Cycle_Rapid(Clear, Clear);
+    }
+  }
+  return 1;
+}
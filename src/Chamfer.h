@@ -1,3 +1,61 @@
+/*
+  Chamfer cycle, ran as a canned cycle (Cycles.h).
+
+  Touch the tool off on the corner to be chamfered: on the diameter, at the face.  Each pass is a
+  straight feed across the corner parallel to the finished chamfer, from the face out to the diameter,
+  at the Z feed per rev.  Passes step in by the depth of cut measured square to the chamfer, the last one
+  leaves the finish allowance for the finishing pass.  The plan is worked out in the OD right hand case
+  and mirrored in Z for a left hand chamfer and in X for an ID chamfer.
+*/
 void Chamfer() {
-    
-}
\ No newline at end of file
+  if (status == 0) {Chamfer_Plan(); Cycle_Begin(Chamfer_Pass);}
+  Cycle_Run();
+}
+
+/** @brief Works the chamfer out in steps from the inputs, ran when the cycle starts */
+void Chamfer_Plan() {
+  double Size, DOC, Finish;
+  if (Metric == 0) {Size = in_Chamfer_Size; DOC = in_DOC; Finish = final_pass_in;}
+  else {Size = mm_Chamfer_Size; DOC = mm_DOC; Finish = final_pass_mm;}
+  Chamfer_Z = Cycle_Steps(Size);
+  Chamfer_X = Cycle_Steps(Size * tan(Chamfer_Angle * PI / 180));
+  Chamfer_Depth = lround(Chamfer_Z * Chamfer_X / sqrt((double)Chamfer_Z * Chamfer_Z + (double)Chamfer_X * Chamfer_X));
+  long Step = Cycle_Steps(DOC);
+  if (Step < 1) {Step = 1;}
+  Chamfer_Finish = Cycle_Steps(Finish);
+  if (Chamfer_Finish > Chamfer_Depth) {Chamfer_Finish = Chamfer_Depth;}
+  Chamfer_Passes = (Chamfer_Depth - Chamfer_Finish + Step - 1) / Step;
+  if (Chamfer_Z <= 0 || Chamfer_X <= 0) {Chamfer_Passes = -1;}       // nothing to cut
+}
+
+/**
+  @brief Queues one pass of the chamfer cycle: roughing passes, the finishing pass, then the return to the start
+  @param Pass  : pass number from 0
+*/
+int Chamfer_Pass(int Pass) {
+  if (Chamfer_Passes < 0) {return 0;}
+  int Finish_Pass = (Chamfer_Finish > 0 || Chamfer_Passes == 0) ? 1 : 0;
+  if (Pass > Chamfer_Passes + Finish_Pass) {return 0;}
+  if (Pass == Chamfer_Passes + Finish_Pass) {Cycle_Rapid(0, 0); return 1;}
+
+  long Z = Chamfer_Z;                                                 // finishing pass cuts the chamfer itself
+  long X = Chamfer_X;
+  if (Pass < Chamfer_Passes) {
+    long Step = (Chamfer_Depth - Chamfer_Finish + Chamfer_Passes - 1) / Chamfer_Passes;
+    long Depth = (Pass + 1) * Step;
+    if (Depth > Chamfer_Depth - Chamfer_Finish) {Depth = Chamfer_Depth - Chamfer_Finish;}
+    Z = lround((double)Chamfer_Z * Depth / Chamfer_Depth);
+    X = lround((double)Chamfer_X * Depth / Chamfer_Depth);
+  }
+  long MZ = (Chamfer_type == 0 || Chamfer_type == 2) ? 1 : -1;        // left hand chamfers face the headstock
+  long MX = (Chamfer_type <= 1) ? 1 : -1;                             // ID chamfers have the work outside the tool
+  long Clear = Cycle_Steps((Metric == 0) ? in_Cycle_Clear : mm_Cycle_Clear);
+  double Feed = (Metric == 0) ? In_FeedRate : mm_FeedRate;
+
+  Cycle_Rapid(MZ * Clear, -MX * X);
+  Cycle_Feed(0, -MX * X, Feed, 0);                                    // feed up to the face
+  Cycle_Feed(-MZ * Z, 0, Feed, 0);                                    // across the corner
+  Cycle_Rapid(-MZ * Z, MX * Clear);
+  Cycle_Rapid(MZ * Clear, MX * Clear);
+  return 1;
+}
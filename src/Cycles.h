@@ -0,0 +1,217 @@
+/*
+  Canned turning cycles.
+
+  A cycle is a plan function that pushes the segments of one pass into the motion planner (Planner.h)
+  relative to where the tool was when the cycle started.  Cycle_Run() keeps the queue topped up a pass
+  at a time, so a cycle can have any number of passes.  Feeds are spindle synchronized segments, the
+  feed is per spindle rev and both axes come off the one accumulator in Sync.h, so an angled cut is
+  exact over its whole length.  The cycle uses the shared status flag: -1 idle, 0 start asked for, 1 running.
+
+  A cycle can also be recorded whole into Cycle_List when it starts and ran from there (Cycle_Record()), for
+  plans that are too much work to redo between segments or that should be known to fit before the first cut.
+*/
+
+/** @brief Length in whole steps, for the cycle plans
+    @param Length  : in or mm, whichever is selected
+*/
+long Cycle_Steps(double Length) {
+  return lround(Steps_per_Move(Length));
+}
+
+/** @brief A segment of a type with nothing else set, no rate, no phase, no pull out and a 0 / 1 ratio
+    @param Type  : Seg_ type
+    @param Z     : leadscrew end position in steps
+    @param X     : cross slide end position in steps
+*/
+Motion_Segment Cycle_Segment(uint8_t Type, long Z, long X) {
+  Motion_Segment Segment;
+  memset(&Segment, 0, sizeof(Motion_Segment));
+  Segment.Type = Type;
+  Segment.Z = Z;
+  Segment.X = X;
+  Segment.Den = 1;
+  return Segment;
+}
+
+/** @brief Queues a rapid to a cycle position
+    @param Z  : leadscrew position in steps from the cycle start
+    @param X  : cross slide position in steps from the cycle start, + = away from the spindle axis
+*/
+void Cycle_Rapid(long Z, long X) {
+  Motion_Segment Segment = Cycle_Segment(Seg_Rapid, Cycle_Origin_Z + Z, Cycle_Origin_X + Retract_Dir * X);
+  Cycle_Add(&Segment);
+  Cycle_Z = Z;
+  Cycle_X = X;
+}
+
+/**
+  @brief Queues a spindle synchronized feed to a cycle position
+  @param Z       : leadscrew position in steps from the cycle start
+  @param X       : cross slide position in steps from the cycle start, + = away from the spindle axis
+  @param Feed    : travel per spindle rev of the feed axis, in or mm
+  @param Feed_X  : 0 = Feed is along Z, 1 = Feed is along X, 2 = Feed is along the path
+*/
+void Cycle_Feed(long Z, long X, double Feed, int Feed_X) {
+  long DZ = labs(Z - Cycle_Z);
+  long DX = labs(X - Cycle_X);
+  Motion_Segment Segment = Cycle_Segment(Seg_Sync, Cycle_Origin_Z + Z, Cycle_Origin_X + Retract_Dir * X);
+  if (Feed_X == 2 && (DZ > 0 || DX > 0)) {Feed = Feed * fmax(DZ, DX) / sqrt((double)DZ * DZ + (double)DX * DX);}
+  Sync_Ratio(Feed, Metric, &Segment.Num, &Segment.Den);
+  // Sync_Ratio() gives steps per count of the feed axis, the sync engine counts the longer axis
+  if (Feed_X == 0 && DX > DZ && DZ > 0) {Segment.Num *= DX; Segment.Den *= DZ;}
+  if (Feed_X == 1 && DZ > DX && DX > 0) {Segment.Num *= DZ; Segment.Den *= DX;}
+  Cycle_Add(&Segment);
+  Cycle_Z = Z;
+  Cycle_X = X;
+}
+
+/**
+  @brief Queues a thread cut to a cycle position, held until the spindle comes round to its start angle so every
+         pass of a start lands in the same groove
+  @param Z          : leadscrew position in steps from the cycle start
+  @param X          : cross slide position in steps from the cycle start, + = away from the spindle axis
+  @param Num        : leadscrew steps per spindle count numerator
+  @param Den        : leadscrew steps per spindle count denominator
+  @param Angle      : spindle counts past angle zero to start on
+  @param Ramp       : spindle counts of lead in ramp before the start angle, see Sync_Start()
+  @param Pull_Run   : leadscrew steps before Z the cross slide starts pulling out, 0 = none, see Sync_Pull()
+  @param Pull_Rise  : cross slide steps it is pulled out by Z
+*/
+void Cycle_Thread(long Z, long X, long long Num, long long Den, long Angle, long Ramp, long Pull_Run, long Pull_Rise) {
+  Motion_Segment Segment = Cycle_Segment(Seg_Sync, Cycle_Origin_Z + Z, Cycle_Origin_X + Retract_Dir * X);
+  Segment.Phase = 1;
+  Segment.Angle = Angle;
+  Segment.Ramp = Ramp;
+  Segment.Pull_Run = Pull_Run;
+  Segment.Pull_Rise = Pull_Rise;
+  Segment.Num = Num;
+  Segment.Den = Den;
+  Cycle_Add(&Segment);
+  Cycle_Z = Z;
+  Cycle_X = X;
+}
+
+/** @brief Queues a rapid that ramps each axis up and down, for modes that leave stepping to Planner_Run()
+    @param Z  : leadscrew position in steps from the cycle start
+    @param X  : cross slide position in steps from the cycle start, + = away from the spindle axis
+*/
+void Cycle_Retract(long Z, long X) {
+  Motion_Segment Segment = Cycle_Segment(Seg_Accel, Cycle_Origin_Z + Z, Cycle_Origin_X + Retract_Dir * X);
+  Cycle_Add(&Segment);
+  Cycle_Z = Z;
+  Cycle_X = X;
+}
+
+/** @brief Queues a dwell where the tool is, timed by the spindle encoder
+    @param Revs  : spindle revs to wait
+*/
+void Cycle_Dwell(double Revs) {
+  Motion_Segment Segment = Cycle_Segment(Seg_Dwell, Cycle_Origin_Z + Cycle_Z, Cycle_Origin_X + Retract_Dir * Cycle_X);
+  Segment.Num = llround(Revs * SpindleCPR);
+  if (Segment.Num > 0) {Cycle_Add(&Segment);}
+}
+
+/**
+  @brief Queues a feed at a constant rate to a cycle position, not tied to the spindle
+  @param Z     : leadscrew position in steps from the cycle start
+  @param X     : cross slide position in steps from the cycle start, + = away from the spindle axis
+  @param Rate  : travel per minute along the path, in or mm
+*/
+void Cycle_Feed_Rate(long Z, long X, double Rate) {
+  Motion_Segment Segment = Cycle_Segment(Seg_Feed, Cycle_Origin_Z + Z, Cycle_Origin_X + Retract_Dir * X);
+  Segment.Rate = Steps_per_Move(Rate) / 60.0;                         // units/min to path steps/sec
+  Cycle_Add(&Segment);
+  Cycle_Z = Z;
+  Cycle_X = X;
+}
+
+/** @brief Pushes a segment into the planner, or onto Cycle_List while a cycle is being recorded */
+void Cycle_Add(const Motion_Segment *Segment) {
+  if (Cycle_Recording == 0) {Planner_Push(Segment); return;}
+  if (Cycle_List_Count < Cycle_List_Size) {Cycle_List[Cycle_List_Count++] = *Segment;}
+  else {Cycle_Overflow = 1;}
+}
+
+/**
+  @brief Records every pass of a plan into Cycle_List, call straight after Cycle_Begin(Cycle_List_Pass)
+  @param Plan  : pushes one pass, returns 0 once there are no passes left
+  @return 0 if the plan did not fit
+*/
+int Cycle_Record(int (*Plan)(int Pass)) {
+  Cycle_List_Count = 0;
+  Cycle_Overflow = 0;
+  Cycle_Recording = 1;
+  for (int Pass = 0; Cycle_Overflow == 0 && Plan(Pass) != 0; Pass++) {}
+  Cycle_Recording = 0;
+  return Cycle_Overflow == 0;
+}
+
+/** @brief Plan function that plays Cycle_List back a segment at a time
+    @param Pass  : segment number from 0
+*/
+int Cycle_List_Pass(int Pass) {
+  if (Pass >= Cycle_List_Count) {return 0;}
+  Planner_Push(&Cycle_List[Pass]);
+  return 1;
+}
+
+/** @brief 1 if the selected mode runs as a canned cycle */
+int Cycle_Mode() {
+  return Mode_Array_Pos == 2 || Mode_Array_Pos == 7 || Mode_Array_Pos == 9 || Mode_Array_Pos == 10 || Mode_Array_Pos == 11 || Mode_Array_Pos == 12 || Mode_Array_Pos == 13;
+}
+
+/** @brief Starts a cycle from the current tool position
+    @param Plan  : pushes one pass, returns 0 once there are no passes left
+*/
+void Cycle_Begin(int (*Plan)(int Pass)) {
+  Planner_Hold = 1;
+  Planner_Clear();
+  Cycle_Origin_Z = LeadScrew.currentPosition();
+  Cycle_Origin_X = CrossSlide.currentPosition();
+  Cycle_Z = 0;
+  Cycle_X = 0;
+  Cycle_Plan = Plan;
+  Cycle_Pass = 0;
+  Cycle_Planned = 0;
+  Cycle_Overflow = 0;
+  Follow_Peak = 0;
+  Planner_Hold = 0;
+  status = 1;
+}
+
+/** @brief Runs the cycle started with Cycle_Begin(), called every loop() pass by the cycle's mode */
+void Cycle_Run() {
+  if (status != 1) {return;}
+  while (Cycle_Planned == 0 && Planner_Free() >= Cycle_Pass_Segments) {
+    if (Cycle_Plan(Cycle_Pass) == 0) {Cycle_Planned = 1;}
+    else {Cycle_Pass++;}
+  }
+  Planner_Run();
+  if (Cycle_Planned == 1 && Planner_Count() == 0 && Planner_Busy == 0) {Planner_Hold = 1; status = -1;}
+}
+
+/** @brief Stops a cycle where it is */
+void Cycle_Stop() {
+  Planner_Hold = 1;
+  Planner_Clear();
+  status = -1;
+}
+
+/** @brief Start page button, starts the cycle or stops the one running */
+void Cycle_Start_Stop() {
+  if (! Enc2.digitalRead(Enc_Button)) {
+    delay(200);
+    if (status == -1) {status = 0;}
+    else {Cycle_Stop();}
+  }
+}
+
+/** @brief Cycle progress on the start page */
+void Cycle_Update() {
+  Feed_Display.setTextSize(1);
+  Feed_Display.setCursor(0,105);
+  if (status == 1) {Feed_Display.print(" Running");}
+  else if (Cycle_Overflow == 1) {Feed_Display.print(" Too many passes");}
+  else {Feed_Display.print(" Ready");}
+  Follow_Display();
+}
@@ -10,8 +10,9 @@ void Refresh() {
     Interface();
     Main_Menu();
     Feed_Display.display();
+    Settings_Update();            // saves edited settings once they settle
     }
-  if (Mode_Array_Pos == 0 && SpindleRPM != 0) {   // Feed rates dont need to be as accurate as threading, so feedrates can be adjustable on the fly
+  if (Mode_Array_Pos == 0 && submenu == 0 && SpindleRPM != 0) {   // Feed rates dont need to be as accurate as threading, so feedrates can be adjustable on the fly
     Mode_0_Feed_Controls();       //  read if feed encoder has been turned
     Feed_Clear();                 //  clear feed value from OLED
     Feed_Adjust();                //  Redraw Feed value
@@ -29,11 +30,51 @@ void Refresh() {
     graph_Radius_Array();
     Graph_Display.display();
   }
-  if (Mode_Array_Pos == 6 && submenu == 5 && SpindleRPM != 0){    //this allows the operation to be stopped when running
+  if (Mode_Array_Pos == 6 && submenu == 6 && SpindleRPM != 0){    //this allows the operation to be stopped when running
     start_or_stop();
     Radius_Update();
     Feed_Display.display();
   }
+  if (Mode_Array_Pos == 2 && submenu == 11 && SpindleRPM != 0){    //canned cycles can be started and stopped with the spindle running
+    Cycle_Start_Stop();
+    Mode_2_SubMenu();
+    Feed_Display.display();
+  }
+  if (Mode_Array_Pos == 7 && submenu == 6 && SpindleRPM != 0){
+    Cycle_Start_Stop();
+    Mode_7_SubMenu();
+    Feed_Display.display();
+  }
+  if (Mode_Array_Pos == 9 && submenu == 7 && SpindleRPM != 0){
+    Cycle_Start_Stop();
+    Mode_9_SubMenu();
+    Feed_Display.display();
+  }
+  if (Mode_Array_Pos == 10 && submenu == 7 && SpindleRPM != 0){
+    Cycle_Start_Stop();
+    Mode_10_SubMenu();
+    Feed_Display.display();
+  }
+  if (Mode_Array_Pos == 11 && submenu == 6 && SpindleRPM != 0){
+    Cycle_Start_Stop();
+    Mode_11_SubMenu();
+    Feed_Display.display();
+  }
+  if (Mode_Array_Pos == 12 && submenu == 5 && SpindleRPM != 0){
+    Cycle_Start_Stop();
+    Mode_12_SubMenu();
+    Feed_Display.display();
+  }
+  if (Mode_Array_Pos == 13 && submenu == 7 && SpindleRPM != 0){
+    Cycle_Start_Stop();
+    Mode_13_SubMenu();
+    Feed_Display.display();
+  }
+  if (Mode_Array_Pos == 14 && submenu == 6 && SpindleRPM != 0){
+    Cycle_Start_Stop();
+    Mode_14_SubMenu();
+    Feed_Display.display();
+  }
   
 }
 
@@ -0,0 +1,51 @@
+/*
+  Facing cycle, ran as a canned cycle (Cycles.h).
+
+  Touch the tool off on the stock diameter at the face.  Each pass steps in Z by the depth of cut and feeds the
+  cross slide in from the diameter to the center, the last roughing pass leaves the finish allowance for the
+  finishing pass.  The feed is per spindle rev off the same accumulator as the leadscrew path, or a constant
+  rate per minute (Face_type 1), which cuts at the same speed across the face but loads the tool less toward
+  the center as the surface speed falls.  The tool backs off the face by the clearance before it rapids out.
+*/
+void Face() {
+  if (status == 0) {Face_Plan(); Cycle_Begin(Face_Pass);}
+  Cycle_Run();
+}
+
+/** @brief Works the face out in steps from the inputs, ran when the cycle starts */
+void Face_Plan() {
+  double Stock, Depth, DOC, Finish;
+  if (Metric == 0) {Stock = in_Outside_Diameter; Depth = in_Face_Depth; DOC = in_DOC; Finish = final_pass_in;}
+  else {Stock = mm_Outside_Diameter; Depth = mm_Face_Depth; DOC = mm_DOC; Finish = final_pass_mm;}
+  Face_Stock = Cycle_Steps(Stock / 2);
+  Face_Depth = Cycle_Steps(Depth);
+  Face_DOC = Cycle_Steps(DOC);
+  if (Face_DOC < 1) {Face_DOC = 1;}
+  Face_Finish = Cycle_Steps(Finish);
+  if (Face_Finish > Face_Depth) {Face_Finish = Face_Depth;}
+  Face_Passes = (Face_Depth - Face_Finish + Face_DOC - 1) / Face_DOC;
+  if (Face_Stock <= 0 || Face_Depth <= 0) {Face_Passes = -1;}        // nothing to cut
+}
+
+/**
+  @brief Queues one pass of the facing cycle: roughing passes, the finishing pass, then the return to the start
+  @param Pass  : pass number from 0
+*/
+int Face_Pass(int Pass) {
+  if (Face_Passes < 0) {return 0;}
+  int Finish_Pass = (Face_Finish > 0) ? 1 : 0;
+  if (Pass > Face_Passes + Finish_Pass) {return 0;}
+  if (Pass == Face_Passes + Finish_Pass) {Cycle_Rapid(0, 0); return 1;}
+
+  long Z = -Face_Depth;                                               // finishing pass cuts the face itself
+  if (Pass < Face_Passes) {Z = -(Pass + 1) * Face_DOC;}
+  if (Pass < Face_Passes && Z < Face_Finish - Face_Depth) {Z = Face_Finish - Face_Depth;}
+  long Clear = Cycle_Steps((Metric == 0) ? in_Cycle_Clear : mm_Cycle_Clear);
+
+  Cycle_Rapid(Z, Clear);
+  if (Face_type == 0) {Cycle_Feed(Z, -Face_Stock, (Metric == 0) ? In_FeedRate : mm_FeedRate, 1);}
+  else {Cycle_Feed_Rate(Z, -Face_Stock, (Metric == 0) ? in_Face_Rate : mm_Face_Rate);}
+  Cycle_Rapid(Z + Clear, -Face_Stock);                                // off the face before the rapid out
+  Cycle_Rapid(Z + Clear, Clear);
+  return 1;
+}
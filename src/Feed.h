@@ -1,13 +1,20 @@
+/*
+  Feed mode locks the leadscrew to the spindle count through the synchronized step generator (Sync.h), so the feed
+  per rev is exact at any spindle speed, follows the spindle when it reverses and breaks the chip when Chip_Break
+  is set.  The lock is taken again whenever the feed or the chip breaking settings change.  With soft stops set
+  (Soft_Stop.h) the carriage slows down and stops on them by itself, run the spindle backward to back off one.
+*/
 void Feed() {
-  double stepsPerSec;
-  if (Metric == 0) {    // Inch Feedrate
-    rpm = SpindleRPM*(In_FeedRate*In_FeedRate)*LeadScrew_TPI;
-  }
-  else if (Metric == 1) {     // Metric Feed Rate
-    rpm = .00155*SpindleRPM*(mm_FeedRate*mm_FeedRate)*LeadScrew_TPI;
-  }
-  stepsPerSec = ((rpm/60)*LeadSPR);   // This outputs steps/second
-  LeadScrew.setSpeed(stepsPerSec);
+  if (Follow_Hold == 1) {return;}                                   // following error trip, stay put until the spindle stops
+  long long Num, Den;
+  if (Metric == 0) {Sync_Ratio(In_FeedRate, 0, &Num, &Den);}        // Inch Feedrate
+  else {Sync_Ratio(mm_FeedRate, 1, &Num, &Den);}                    // Metric Feed Rate
+  long Window = 0, Cut = 0;
+  int Break = Chip_Break_Plan(&Window, &Cut);
+  if (Sync_Active == 1 && Sync_Endless == 1 && Sync_Phase == 0 && Num == Sync_Num && Den == Sync_Den && Break == Sync_Break_Type &&
+      (Break == 0 || (Window == Sync_Break_Window && Cut == Sync_Break_Cut))) {return;}
+  if (Sync_Active == 1 || Sync_Endless == 1) {Sync_Stop();}
+  Sync_Lock(Num, Den);
 }
 
 void Turn_to_Diameter(){
@@ -0,0 +1,48 @@
+/*
+  Following error monitor.
+
+  The spindle count times the selected ratio says where the leadscrew should be, the step count says where
+  it is.  Synchronized moves, Feed and Thread mode's lock included, check every step generator tick.  Crossing
+  the limit holds the feed where it is and pulls the cross slide back by the retract distance, the hold clears
+  once the spindle has stopped.
+*/
+
+/** @brief Records one error sample, kept to a few compares since Sync_Step() calls it every tick
+    @param Error  : target minus actual steps of the axis
+*/
+inline void Follow_Check(long Error) {
+  Follow_Error = Error;
+  long Size = labs(Error);
+  if (Size > Follow_Peak) {Follow_Peak = Size;}
+  if (Size > Follow_Limit_Steps) {Follow_Tripped = 1;}
+}
+
+/** @brief Runs the monitor, ran at the start of every loop() pass */
+void Follow_Update() {
+  if (Metric == 0) {Follow_Limit_Steps = Steps_per_Move(in_Follow_Limit);}
+  else {Follow_Limit_Steps = Steps_per_Move(mm_Follow_Limit);}
+
+  if (Follow_Tripped == 1 && Follow_Hold == 0) {Follow_Trip();}
+
+  if (Follow_Hold == 1) {
+    ZY_Steppers.run();                                            // retract runs whatever mode is selected
+    if (SpindleRPM == 0 && LeadScrew.distanceToGo() == 0 && CrossSlide.distanceToGo() == 0) {
+      Follow_Hold = 0;
+      Follow_Tripped = 0;
+    }
+  }
+}
+
+/** @brief Feed hold and retract, everything that moves along with the spindle is stopped where it is */
+void Follow_Trip() {
+  Follow_Hold = 1;
+  Planner_Hold = 1;
+  Planner_Clear();                                                // also hands a tripped synchronized move back to AccelStepper
+  if (Sync_Endless == 1 || Sync_Profile_On == 1) {Sync_Stop();}   // Feed and Thread mode's lock and a polygon cut are not planner segments
+  status = -1;
+  long Retract;
+  if (Metric == 0) {Retract = Steps_per_Move(in_Follow_Retract);}
+  else {Retract = Steps_per_Move(mm_Follow_Retract);}
+  long Target[2] = {LeadScrew.currentPosition(), CrossSlide.currentPosition() + Retract_Dir * Retract};
+  ZY_Steppers.moveTo(Target);
+}
@@ -0,0 +1,291 @@
+/*
+  Streaming G-code interpreter.
+
+  G-code text comes in over the serial protocol (Msg_GCode) into GCode_Text, GCode_Update() takes
+  one line per loop() pass, parses it with GCode_Parse_Line() and queues the motion segments.
+  Arcs and G76 cycles are queued a piece at a time as room frees up in the motion queue, and
+  no new line is taken until the last one is fully queued, so the host can send as fast as
+  GCode_Receive() accepts text and the lathe never waits on the host.
+
+  Supported:
+    G0 rapid, G1 feed, G2/G3 arc (I, K center offsets, split into chords), G33 spindle synchronized
+    move (K = lead along Z), G76 threading cycle (P pitch, Z end, I crest offset from the drive line,
+    J first pass depth, K thread depth, R depth degression, H spring passes), G7/G8 diameter/radius X,
+    G18, G20/G21, G90/G91, G92, G94/G95, M0 M1 M2 M3 M4 M5 M8 M9 M30 (only M2/M30 do anything).
+  Program zero is where the tool sits when the program is reset, until G92 moves it.
+*/
+
+//----G-Code mode, this is ran in the loop()----//
+void G_Code() {
+  GCode_Update();
+  Planner_Run();
+}
+
+/** @brief Text buffer space left for Msg_GCode */
+int GCode_Text_Free() {
+  return GCode_Text_Size - 1 - (GCode_Text_Tail - GCode_Text_Head + GCode_Text_Size) % GCode_Text_Size;
+}
+
+/** @brief Takes a chunk of G-code text from the host, all of it or none.  Returns 1 if it was taken
+    @param Text  : G-code text, lines end with \n and may be split across chunks
+    @param Size  : bytes of text
+*/
+int GCode_Receive(const uint8_t *Text, int Size) {
+  if (Size > GCode_Text_Free()) {return 0;}
+  for (int i = 0; i < Size; i++) {
+    GCode_Text[GCode_Text_Tail] = Text[i];
+    GCode_Text_Tail = (GCode_Text_Tail + 1) % GCode_Text_Size;
+  }
+  return 1;
+}
+
+/** @brief Puts every modal setting back to its power up state, as M2/M30 do */
+void GCode_Modal_Defaults() {
+  GCode_Motion = 0;
+  GCode_Metric = 0;
+  GCode_Relative = 0;
+  GCode_Per_Rev = 0;
+  GCode_Diameter = 0;
+  GCode_Feed = 0;
+  GCode_Lead = 0;
+}
+
+/** @brief Drops any text not yet parsed and starts a new program from the current tool position */
+void GCode_Reset() {
+  GCode_Text_Head = GCode_Text_Tail;
+  GCode_Line_Length = 0;
+  GCode_Line_Overflow = 0;
+  GCode_Lines = 0;
+  GCode_Error = 0;
+  GCode_Error_Line = 0;
+  GCode_Expand = GCode_Expand_None;
+  GCode_Modal_Defaults();
+  GCode_Z = 0;
+  GCode_X = 0;
+  GCode_Origin_Z = LeadScrew.currentPosition();
+  GCode_Origin_X = CrossSlide.currentPosition();
+  Follow_Peak = 0;
+}
+
+/**
+  @brief Parses the next line once the last one is fully queued.  After an error the rest of the program
+         is read and thrown away so the host is never left waiting, GCode_Reset() starts over
+*/
+void GCode_Update() {
+  if (GCode_Expand != GCode_Expand_None) {
+    GCode_Expand_Next();
+    if (GCode_Expand != GCode_Expand_None) {return;}
+  }
+  if (Planner_Free() < 1) {return;}                          // room for the one segment a plain line queues
+
+  while (GCode_Text_Head != GCode_Text_Tail) {
+    char c = GCode_Text[GCode_Text_Head];
+    GCode_Text_Head = (GCode_Text_Head + 1) % GCode_Text_Size;
+    if (c != '\n') {
+      if (GCode_Line_Length < GCode_Line_Size - 1) {GCode_Line[GCode_Line_Length++] = c;}
+      else {GCode_Line_Overflow = 1;}
+      continue;
+    }
+
+    GCode_Line[GCode_Line_Length] = 0;
+    GCode_Line_Length = 0;
+    GCode_Lines++;
+    int Result = GCode_Too_Long;
+    if (GCode_Line_Overflow == 0) {
+      GCode_Block Block;
+      Result = GCode_Parse_Line(GCode_Line, &Block);
+      if (Result == GCode_OK && GCode_Error == 0) {Result = GCode_Execute(&Block);}
+    }
+    GCode_Line_Overflow = 0;
+    if (Result != GCode_OK && Result != GCode_Empty && GCode_Error == 0) {
+      GCode_Error = Result;
+      GCode_Error_Line = GCode_Lines;
+      Planner_Hold = 1;                                       // stop at the end of the segment running now
+    }
+    return;                                                   // one line per loop() pass
+  }
+}
+
+/** @brief Converts a length in program units to steps, both axes use the leadscrew scale like Steps_per_Move()
+    @param Value  : inch after G20, mm after G21
+*/
+long GCode_Steps(double Value) {
+  if (GCode_Metric == 0) {return lround(Value / .001 * Steps_Per_Thou);}
+  return lround(Value / .01 * Steps_Per_hundredth_mm);
+}
+
+/** @brief Acts on one parsed line, returns GCode_OK or the reason it could not
+    @param Block  : words of the line
+*/
+int GCode_Execute(const GCode_Block *Block) {
+  int Motion = -1;
+  int Thread_Cycle = 0;
+  int Set_Origin = 0;
+  for (int i = 0; i < Block->G_Count; i++) {
+    int G = Block->G[i];
+    if (G == 0 || G == 10 || G == 20 || G == 30) {Motion = G / 10;}
+    else if (G == 330) {Motion = 33;}
+    else if (G == 760) {Thread_Cycle = 1;}
+    else if (G == 70) {GCode_Diameter = 1;}
+    else if (G == 80) {GCode_Diameter = 0;}
+    else if (G == 180) {}                                     // ZX plane, the only one a lathe has
+    else if (G == 200 && GCode_Metric == 1) {GCode_Metric = 0; GCode_Z /= 25.4; GCode_X /= 25.4;}   // programmed position follows the units
+    else if (G == 210 && GCode_Metric == 0) {GCode_Metric = 1; GCode_Z *= 25.4; GCode_X *= 25.4;}
+    else if (G == 200 || G == 210) {}
+    else if (G == 900) {GCode_Relative = 0;}
+    else if (G == 910) {GCode_Relative = 1;}
+    else if (G == 920) {Set_Origin = 1;}
+    else if (G == 940) {GCode_Per_Rev = 0;}
+    else if (G == 950) {GCode_Per_Rev = 1;}
+    else {return GCode_Unsupported;}
+  }
+  if (Block->M != -1) {
+    int M = Block->M;
+    if (M == 2 || M == 30) {GCode_Modal_Defaults();}
+    else if (M != 0 && M != 1 && M != 3 && M != 4 && M != 5 && M != 8 && M != 9) {return GCode_Unsupported;}   // spindle and coolant are manual
+  }
+  if (GCode_Has(Block, 'F')) {GCode_Feed = Block->Value['F' - 'A'];}
+
+  double Z = GCode_Z;
+  double X = GCode_X;
+  double X_Word = 0;
+  if (GCode_Has(Block, 'X')) {X_Word = Block->Value['X' - 'A']; if (GCode_Diameter == 1) {X_Word = X_Word / 2;}}
+
+  if (Set_Origin == 1) {                                      // G92, the tool is now at the given position
+    if (GCode_Has(Block, 'Z')) {GCode_Origin_Z += GCode_Steps(GCode_Z) - GCode_Steps(Block->Value['Z' - 'A']); GCode_Z = Block->Value['Z' - 'A'];}
+    if (GCode_Has(Block, 'X')) {GCode_Origin_X += GCode_Steps(GCode_X) - GCode_Steps(X_Word); GCode_X = X_Word;}
+    return GCode_OK;
+  }
+
+  if (GCode_Has(Block, 'Z')) {Z = GCode_Relative ? Z + Block->Value['Z' - 'A'] : Block->Value['Z' - 'A'];}
+  if (GCode_Has(Block, 'X')) {X = GCode_Relative ? X + X_Word : X_Word;}
+  if (Thread_Cycle == 1) {return GCode_Thread_Cycle(Block, Z);}
+
+  if (Motion != -1) {GCode_Motion = Motion;}
+  if (!GCode_Has(Block, 'Z') && !GCode_Has(Block, 'X')) {return GCode_OK;}
+  if (GCode_Motion == 2 || GCode_Motion == 3) {return GCode_Arc(GCode_Motion, Block, Z, X);}
+  if (GCode_Motion == 1 && GCode_Feed <= 0) {return GCode_Missing;}
+  if (GCode_Motion == 33) {
+    if (GCode_Has(Block, 'K')) {GCode_Lead = Block->Value['K' - 'A'];}
+    if (GCode_Lead <= 0 || Z == GCode_Z) {return GCode_Missing;}   // the lead is along Z, so Z has to move
+  }
+  GCode_Move(GCode_Motion, Z, X);
+  return GCode_OK;
+}
+
+/**
+  @brief Queues a straight move from the programmed position and makes the end of it the new programmed
+         position.  Motion 0 = rapid, 1 = feed (per minute or per rev), 33 = spindle synchronized at GCode_Lead
+*/
+void GCode_Move(int Motion, double Z, double X) {
+  Motion_Segment Segment = Cycle_Segment(Seg_Rapid, GCode_Origin_Z + GCode_Steps(Z), GCode_Origin_X + GCode_Steps(X));
+  double DZ = labs(Segment.Z - (GCode_Origin_Z + GCode_Steps(GCode_Z)));
+  double DX = labs(Segment.X - (GCode_Origin_X + GCode_Steps(GCode_X)));
+  GCode_Z = Z;
+  GCode_X = X;
+  if (DZ == 0 && (DX == 0 || Motion == 33)) {return;}      // nothing to do, or a thread with no Z travel to set the lead on
+  double Path = sqrt(DZ * DZ + DX * DX);
+  double Dominant = fmax(DZ, DX);
+
+  if (Motion == 1 && GCode_Per_Rev == 0) {
+    Segment.Type = Seg_Feed;
+    Segment.Rate = GCode_Steps(GCode_Feed) / 60.0;            // units/min to path steps/sec
+  }
+  if (Motion == 1 && GCode_Per_Rev == 1) {                    // feed along the path per rev, scaled onto the dominant axis
+    Segment.Type = Seg_Sync;
+    Sync_Ratio(GCode_Feed * Dominant / Path, GCode_Metric, &Segment.Num, &Segment.Den);
+  }
+  if (Motion == 33) {                                         // lead is along Z, every pass starts on the same spindle angle
+    Segment.Type = Seg_Sync;
+    Segment.Phase = 1;
+    Sync_Ratio(GCode_Lead * Dominant / DZ, GCode_Metric, &Segment.Num, &Segment.Den);
+  }
+  Planner_Push(&Segment);
+}
+
+/** @brief Sets up a G2/G3 arc to be queued as chords, the chords are short enough to stay within GCode_Arc_Tolerance_in of the arc
+    @param Motion  : 2 = clockwise, 3 = counter clockwise, looking down on the ZX plane from +Y
+    @param Block   : words of the line, I and K are the center offsets from the start in X and Z
+    @param Z       : end point
+    @param X       : end point
+*/
+int GCode_Arc(int Motion, const GCode_Block *Block, double Z, double X) {
+  if (!GCode_Has(Block, 'I') && !GCode_Has(Block, 'K')) {return GCode_Missing;}
+  if (GCode_Feed <= 0) {return GCode_Missing;}
+  double Tolerance = GCode_Arc_Tolerance_in;
+  if (GCode_Metric == 1) {Tolerance = Tolerance * 25.4;}
+  GCode_Arc_Z = GCode_Z + (GCode_Has(Block, 'K') ? Block->Value['K' - 'A'] : 0);
+  GCode_Arc_X = GCode_X + (GCode_Has(Block, 'I') ? Block->Value['I' - 'A'] : 0);
+  GCode_Arc_Radius = hypot(GCode_Z - GCode_Arc_Z, GCode_X - GCode_Arc_X);
+  double End_Radius = hypot(Z - GCode_Arc_Z, X - GCode_Arc_X);
+  if (GCode_Arc_Radius <= 0 || fabs(End_Radius - GCode_Arc_Radius) > Tolerance * 10) {return GCode_Bad_Arc;}
+
+  GCode_Arc_Angle = atan2(GCode_X - GCode_Arc_X, GCode_Z - GCode_Arc_Z);
+  double Sweep = atan2(X - GCode_Arc_X, Z - GCode_Arc_Z) - GCode_Arc_Angle;
+  if (Motion == 3 && Sweep <= 0) {Sweep += 2 * PI;}         // same start and end is a full circle
+  if (Motion == 2 && Sweep >= 0) {Sweep -= 2 * PI;}
+  double Step_Max = PI / 2;
+  if (Tolerance < GCode_Arc_Radius) {Step_Max = fmin(Step_Max, 2 * acos(1 - Tolerance / GCode_Arc_Radius));}
+  int Chords = ceil(fabs(Sweep) / Step_Max);
+  Chords = constrain(Chords, 1, GCode_Arc_Max_Chords);
+
+  GCode_Arc_Step = Sweep / Chords;
+  GCode_Arc_Left = Chords;
+  GCode_Arc_End_Z = Z;
+  GCode_Arc_End_X = X;
+  GCode_Expand = GCode_Expand_Arc;
+  GCode_Expand_Next();
+  return GCode_OK;
+}
+
+/** @brief Sets up a G76 threading cycle from the current position (the drive line) to Z, the passes are queued by GCode_Expand_Next()
+    @param Block  : words of the line
+    @param Z      : end of the thread
+*/
+int GCode_Thread_Cycle(const GCode_Block *Block, double Z) {
+  if (!GCode_Has(Block, 'P') || !GCode_Has(Block, 'I') || !GCode_Has(Block, 'J') || !GCode_Has(Block, 'K')) {return GCode_Missing;}
+  if (GCode_Has(Block, 'Q') || GCode_Has(Block, 'E') || GCode_Has(Block, 'L')) {return GCode_Unsupported;}    // straight infeed only
+  if (Block->Value['P' - 'A'] <= 0 || Block->Value['J' - 'A'] <= 0 || Block->Value['I' - 'A'] == 0 || Z == GCode_Z) {return GCode_Missing;}
+  GCode_Lead = Block->Value['P' - 'A'];
+  GCode_Thread_Start_Z = GCode_Z;
+  GCode_Thread_End_Z = Z;
+  GCode_Thread_Drive_X = GCode_X;
+  GCode_Thread_Peak_X = GCode_X + Block->Value['I' - 'A'];
+  GCode_Thread_First = Block->Value['J' - 'A'];
+  GCode_Thread_Depth = fabs(Block->Value['K' - 'A']);
+  GCode_Thread_Degression = GCode_Has(Block, 'R') ? Block->Value['R' - 'A'] : 1;
+  if (GCode_Thread_Degression < 1) {GCode_Thread_Degression = 1;}
+  GCode_Thread_Spring = GCode_Has(Block, 'H') ? (int)Block->Value['H' - 'A'] : 0;
+  GCode_Thread_Pass = 1;
+  GCode_Thread_Done = 0;
+  GCode_Expand = GCode_Expand_Thread;
+  GCode_Expand_Next();
+  return GCode_OK;
+}
+
+/** @brief Queues as much of the arc or threading cycle being expanded as the motion queue has room for */
+void GCode_Expand_Next() {
+  while (GCode_Expand == GCode_Expand_Arc && Planner_Free() > 0) {
+    GCode_Arc_Left--;
+    if (GCode_Arc_Left == 0) {                                // last chord ends exactly on the programmed point
+      GCode_Move(1, GCode_Arc_End_Z, GCode_Arc_End_X);
+      GCode_Expand = GCode_Expand_None;
+    } else {
+      GCode_Arc_Angle += GCode_Arc_Step;
+      GCode_Move(1, GCode_Arc_Z + GCode_Arc_Radius * cos(GCode_Arc_Angle), GCode_Arc_X + GCode_Arc_Radius * sin(GCode_Arc_Angle));
+    }
+  }
+
+  while (GCode_Expand == GCode_Expand_Thread && Planner_Free() >= 4) {   // each pass is in, cut, out, back
+    double Depth = GCode_Thread_First * pow(GCode_Thread_Pass, 1 / GCode_Thread_Degression);
+    if (Depth >= GCode_Thread_Depth) {Depth = GCode_Thread_Depth; GCode_Thread_Done++;}
+    double Infeed = (GCode_Thread_Peak_X < GCode_Thread_Drive_X) ? -1 : 1;    // outside threads cut toward the center
+    double Cut_X = GCode_Thread_Peak_X + Infeed * Depth;
+    GCode_Move(0, GCode_Thread_Start_Z, Cut_X);
+    GCode_Move(33, GCode_Thread_End_Z, Cut_X);
+    GCode_Move(0, GCode_Thread_End_Z, GCode_Thread_Drive_X);
+    GCode_Move(0, GCode_Thread_Start_Z, GCode_Thread_Drive_X);
+    GCode_Thread_Pass++;
+    if (GCode_Thread_Done > GCode_Thread_Spring) {GCode_Expand = GCode_Expand_None;}
+  }
+}
@@ -0,0 +1,67 @@
+/*
+  Grooving cycle, ran as a canned cycle (Cycles.h).
+
+  Touch the tool off on the stock diameter with its tailstock side edge on the end face.  A groove wider than
+  the tool is roughed with plunges spaced evenly from the near wall to the far wall, each overlapping the last
+  by at least Groove_Overlap of the tool width, fed in X per spindle rev and held at the bottom for Groove_Dwell
+  revs.  They leave the finish allowance on the walls and floor for the finishing sweep: down the near wall, along
+  the floor and back out up the far wall.  Every move is queued ahead, so one plunge follows the next straight away.
+*/
+void Groove() {
+  if (status == 0) {Groove_Plan(); Cycle_Begin(Groove_Pass);}
+  Cycle_Run();
+}
+
+/** @brief Works the groove out in steps from the inputs, ran when the cycle starts */
+void Groove_Plan() {
+  double Position, Width, Depth, Tool, Finish;
+  if (Metric == 0) {Position = in_Groove_Position; Width = in_Groove_Width; Depth = in_Groove_Depth; Tool = in_Groove_Tool; Finish = final_pass_in;}
+  else {Position = mm_Groove_Position; Width = mm_Groove_Width; Depth = mm_Groove_Depth; Tool = mm_Groove_Tool; Finish = final_pass_mm;}
+  long Tool_Steps = Cycle_Steps(Tool);
+  Groove_Near = -Cycle_Steps(Position);
+  Groove_Far = -Cycle_Steps(Position + Width) + Tool_Steps;
+  Groove_Depth = Cycle_Steps(Depth);
+  Groove_Finish = Cycle_Steps(Finish);
+  if (Groove_Finish > Groove_Depth) {Groove_Finish = Groove_Depth;}
+
+  long Span = Groove_Near - Groove_Far - 2 * Groove_Finish;           // roughing range of the tool edge
+  if (Span < 0) {Span = 0;}
+  long Step = Tool_Steps * (1 - Groove_Overlap);
+  if (Step < 1) {Step = 1;}
+  Groove_Plunges = (Span + Step - 1) / Step + 1;
+  if (Tool_Steps <= 0 || Groove_Far > Groove_Near || Groove_Depth <= 0) {Groove_Plunges = -1;}   // nothing to cut, or the tool is wider than the groove
+}
+
+/**
+  @brief Queues one plunge of the grooving cycle, then the finishing sweep and the return to the start
+  @param Pass  : pass number from 0
+*/
+int Groove_Pass(int Pass) {
+  if (Groove_Plunges < 0) {return 0;}
+  int Finish_Pass = (Groove_Finish > 0 || Groove_Near != Groove_Far) ? 1 : 0;
+  if (Pass > Groove_Plunges + Finish_Pass) {return 0;}
+  if (Pass == Groove_Plunges + Finish_Pass) {Cycle_Rapid(0, 0); return 1;}
+  long Clear = Cycle_Steps((Metric == 0) ? in_Cycle_Clear : mm_Cycle_Clear);
+  double Feed = (Metric == 0) ? In_FeedRate : mm_FeedRate;
+
+  if (Pass == Groove_Plunges) {                                       // finishing sweep
+    Cycle_Rapid(Groove_Near, Clear);
+    Cycle_Feed(Groove_Near, -Groove_Depth, Feed, 1);
+    Cycle_Dwell(Groove_Dwell);
+    if (Groove_Far != Groove_Near) {Cycle_Feed(Groove_Far, -Groove_Depth, Feed, 0);}   // along the floor
+    Cycle_Feed(Groove_Far, 0, Feed, 1);
+    Cycle_Rapid(Groove_Far, Clear);
+    return 1;
+  }
+
+  long Near = Groove_Near - Groove_Finish;
+  long Far = Groove_Far + Groove_Finish;
+  if (Far > Near) {Near = (Groove_Near + Groove_Far) / 2; Far = Near;}  // too narrow to leave the allowance on the walls
+  long Z = Near;
+  if (Groove_Plunges > 1) {Z = Near - lround((double)(Near - Far) * Pass / (Groove_Plunges - 1));}
+  Cycle_Rapid(Z, Clear);
+  Cycle_Feed(Z, Groove_Finish - Groove_Depth, Feed, 1);
+  Cycle_Dwell(Groove_Dwell);
+  Cycle_Rapid(Z, Clear);
+  return 1;
+}
@@ -2,13 +2,66 @@ void Interface() {
 
   Mode_Selection();                                            // Mode selection routine using Enc1
     Mode_0_Feed_Controls();                                    // Feed menu controls
+      if (Mode_Array_Pos == 0) {Mode_0_SubMenu_Controls();}    // Sub Menu for Mode 0, ran only when Mode = 0
     Mode_1_Thread_Controls();                                  // Thread menu controls
+      if (Mode_Array_Pos == 1) {Mode_1_SubMenu_Controls();}    // Sub Menu for Mode 1, ran only when Mode = 1
     Mode_2_Auto_Thread_Controls();                             // Thread menu controls
       if (Mode_Array_Pos == 2) {Mode_2_SubMenu_Controls();}    // Sub Menu for Mode 2, ran only when Mode = 2
     Mode_3_Auto_Turn_Controls();                               // Auto Turn controls
       if (Mode_Array_Pos == 3) {Mode_3_SubMenu_Controls();}    // Sub Menu for Mode 3, ran only when Mode = 3
     Mode_6_Auto_Radius_Controls();                             // Auto Radius Menu
       if (Mode_Array_Pos == 6) {Mode_6_SubMenu_Controls();}    // Sub Menu for Mode 6, ran only when Mode = 6
+    Mode_7_Chamfer_Controls();                                 // Chamfer controls
+      if (Mode_Array_Pos == 7) {Mode_7_SubMenu_Controls();}    // Sub Menu for Mode 7, ran only when Mode = 7
+    Mode_9_Taper_Controls();                                   // Taper controls
+      if (Mode_Array_Pos == 9) {Mode_9_SubMenu_Controls();}    // Sub Menu for Mode 9, ran only when Mode = 9
+    Mode_10_Ball_Controls();                                   // Ball controls
+      if (Mode_Array_Pos == 10) {Mode_10_SubMenu_Controls();}  // Sub Menu for Mode 10, ran only when Mode = 10
+    Mode_11_Face_Controls();                                   // Face controls
+      if (Mode_Array_Pos == 11) {Mode_11_SubMenu_Controls();}  // Sub Menu for Mode 11, ran only when Mode = 11
+    Mode_12_Part_Controls();                                   // Parting controls
+      if (Mode_Array_Pos == 12) {Mode_12_SubMenu_Controls();}  // Sub Menu for Mode 12, ran only when Mode = 12
+    Mode_13_Groove_Controls();                                 // Groove controls
+      if (Mode_Array_Pos == 13) {Mode_13_SubMenu_Controls();}  // Sub Menu for Mode 13, ran only when Mode = 13
+    Mode_14_Polygon_Controls();                                // Polygon controls
+      if (Mode_Array_Pos == 14) {Mode_14_SubMenu_Controls();}  // Sub Menu for Mode 14, ran only when Mode = 14
+}
+
+/**
+  @brief Steps a value with Enc2, turning faster adds the fast and faster amounts on top
+  @param Value   : setting to adjust
+  @param Step    : change per detent
+  @param Fast    : added when Enc2 has moved more than one detent
+  @param Faster  : added when Enc2 has moved more than three detents
+  @param Min     : lower bound
+*/
+void Adjust_Value(double *Value, double Step, double Fast, double Faster, double Min) {
+  if (Enc2.getEncoderPosition() < 0) {
+    *Value = *Value + Step;
+    if (Enc2.getEncoderPosition() < -1) { *Value = *Value + Fast;}           // Fast Scroll
+    if (Enc2.getEncoderPosition() < -3) { *Value = *Value + Faster;}         // Faster Scroll
+    Enc2.setEncoderPosition(0);
+  }
+  if (Enc2.getEncoderPosition() > 0) {
+    *Value = *Value - Step;
+    if (Enc2.getEncoderPosition() > 1) { *Value = *Value - Fast;}            // Fast Scroll
+    if (Enc2.getEncoderPosition() > 3) { *Value = *Value - Faster;}          // Faster Scroll
+    Enc2.setEncoderPosition(0);
+  }
+  if (*Value < Min) {*Value = Min;}
+}
+
+/**
+  @brief Watches the Enc2 button without waiting on it, for pages that act on a press or time how long it is held.
+         An edge is only taken Button_Debounce ms after the last one, so contact bounce is never a second press
+  @return 1 on the pass the button goes down, -1 on the pass it comes back up, 0 otherwise
+*/
+int Enc2_Button_Edge() {
+  int Down = ! Enc2.digitalRead(Enc_Button);
+  if (Down == Enc2_Button_Down || millis() - Enc2_Button_Time < Button_Debounce) {return 0;}
+  Enc2_Button_Down = Down;
+  Enc2_Button_Time = millis();
+  return Down ? 1 : -1;
 }
 
 void Mode_Selection() {                                       // Mode Selection
@@ -34,7 +87,7 @@ void Mode_Selection() {                                       // Mode Selection
 
 void Mode_0_Feed_Controls() {                                 // Feed Mode
 //----Mode 0 (Feed) Controls----//
-  if (Mode_Array_Pos == 0) {
+  if (Mode_Array_Pos == 0 && submenu == 0) {
     if (! Enc2.digitalRead(Enc_Button) && SpindleRPM == 0) {        //do stuff if Encoder button is pressed and spindle speed is zero
       delay(200);
       if (Measure_Array_Pos == 0) {
@@ -80,9 +133,49 @@ void Mode_0_Feed_Controls() {                                 // Feed Mode
   }
 }
 
+void Mode_0_SubMenu_Controls() {                              // Feed Sub Menu, chip breaking and soft stops
+  // use Enc1 button to activate sub menu
+  // use Enc1 encoder to traverse/exit menu
+  // use Enc2 encoder to modify values
+
+  if (! Enc1.digitalRead(Enc_Button) && Mode_Array_Pos == 0 && submenu == 0) {    // submenu button control
+    delay(200);
+    submenu = 1;
+    Enc1.setEncoderPosition(submenu);
+  }
+
+  if (submenu >= 1) {
+    if (Enc1.getEncoderPosition() < submenu) { submenu++; Enc1.setEncoderPosition(submenu);}
+    if (Enc1.getEncoderPosition() > submenu && submenu >= 2) { submenu--; Enc1.setEncoderPosition(submenu);}
+    if (Enc1.getEncoderPosition() != submenu) {Enc1.setEncoderPosition(submenu);}
+    if (submenu > 7) { submenu = 0; Enc1.setEncoderPosition(Mode_Array_Pos);
+       Main_Menu(); Feed_Display.display(); delay(400);                          // reduces the chance of changing mode when leaving submenu
+    }
+  }
+
+  if (submenu == 1) {                                                           // submenu 1 chip breaking off, pause or back off
+    if (Enc2.getEncoderPosition() < 0 && Chip_Break < 2) {Chip_Break++;}
+    if (Enc2.getEncoderPosition() > 0 && Chip_Break > 0) {Chip_Break--;}
+    Enc2.setEncoderPosition(0);
+  }
+  if (submenu == 2) {                                                           // submenu 2 revs between breaks
+    if (Enc2.getEncoderPosition() < 0 && Chip_Break_Revs < 100) {Chip_Break_Revs++;}
+    if (Enc2.getEncoderPosition() > 0 && Chip_Break_Revs > 1) {Chip_Break_Revs--;}
+    Enc2.setEncoderPosition(0);
+  }
+  if (submenu == 3) {                                                           // submenu 3 spindle degrees per break
+    Adjust_Value(&Chip_Break_Degrees, 1, 4, 20, 1);
+    if (Chip_Break_Degrees > 180) {Chip_Break_Degrees = 180;}
+  }
+  if (submenu == 4) {Soft_Stop_Controls(&Z_Soft, 0, LeadScrew);}               // submenu 4 Z stop toward the headstock
+  if (submenu == 5) {Soft_Stop_Controls(&Z_Soft, 1, LeadScrew);}               // submenu 5 Z stop toward the tailstock
+  if (submenu == 6) {Soft_Stop_Controls(&X_Soft, 0, CrossSlide);}              // submenu 6 X stop, low end of the cross slide
+  if (submenu == 7) {Soft_Stop_Controls(&X_Soft, 1, CrossSlide);}              // submenu 7 X stop, high end of the cross slide
+}
+
 void Mode_1_Thread_Controls() {                               // Thread Mode
 //----Mode 1 (Thread) Controls----//
-  if (Mode_Array_Pos == 1) {
+  if (Mode_Array_Pos == 1 && submenu == 0) {
     if (! Enc2.digitalRead(Enc_Button)) {
       delay(200);
       if (Thread_Mode == 0) {
@@ -124,9 +217,49 @@ void Mode_1_Thread_Controls() {                               // Thread Mode
   }
 }
 
+void Mode_1_SubMenu_Controls() {                              // Thread Sub Menu, thread stop, hand and pull out
+  // use Enc1 button to activate sub menu
+  // use Enc1 encoder to traverse/exit menu
+  // use Enc2 encoder to modify values
+
+  if (! Enc1.digitalRead(Enc_Button) && Mode_Array_Pos == 1 && submenu == 0) {    // submenu button control
+    delay(200);
+    submenu = 1;
+    Enc1.setEncoderPosition(submenu);
+  }
+
+  if (submenu >= 1) {
+    if (Enc1.getEncoderPosition() < submenu) { submenu++; Enc1.setEncoderPosition(submenu);}
+    if (Enc1.getEncoderPosition() > submenu && submenu >= 2) { submenu--; Enc1.setEncoderPosition(submenu);}
+    if (Enc1.getEncoderPosition() != submenu) {Enc1.setEncoderPosition(submenu);}
+    if (submenu > 3) { submenu = 0; Enc1.setEncoderPosition(Mode_Array_Pos);
+       Main_Menu(); Feed_Display.display(); delay(400);                          // reduces the chance of changing mode when leaving submenu
+    }
+  }
+
+  if (submenu == 1) {                                                           // submenu 1 thread stop, 0 = off
+    if (Thread_Mode == 0) {Adjust_Value(&in_Thread_Stop, .001, .01, .25, 0);}
+    if (Thread_Mode == 1) {Adjust_Value(&mm_Thread_Stop, .01, .1, 1.5, 0);}
+  }
+  if (submenu == 2) {                                                           // submenu 2 right or left hand
+    if (Enc2.getEncoderPosition() < 0 && Thread_Hand < Hand_Array_Size - 1) {Thread_Hand++;}
+    if (Enc2.getEncoderPosition() > 0 && Thread_Hand > 0) {Thread_Hand--;}
+    Enc2.setEncoderPosition(0);
+  }
+  if (submenu == 3) {                                                           // submenu 3 pull out angle at the stop, 0 = off
+    Adjust_Value(&Thread_Pull_Angle, 1, 5, 15, 0);
+    if (Thread_Pull_Angle > Thread_Pull_Angle_Max) {Thread_Pull_Angle = Thread_Pull_Angle_Max;}
+  }
+}
+
 void Mode_2_Auto_Thread_Controls() {                          // Auto Thread Mode
 //----Mode 2 (Auto Thread) Controls----//
-  if (Mode_Array_Pos == 2 && submenu == 0) {
+  if (Mode_Array_Pos == 2 && submenu == 0 && status == -1 && Thread_Taper != 0) {   // pipe thread, scroll the size
+    if (Enc2.getEncoderPosition() < 0 && Pipe_Array_Pos < Pipe_Array_Size - 1) {Pipe_Array_Pos++; Pipe_Select();}
+    if (Enc2.getEncoderPosition() > 0 && Pipe_Array_Pos > 0) {Pipe_Array_Pos--; Pipe_Select();}
+    Enc2.setEncoderPosition(0);
+  }
+  if (Mode_Array_Pos == 2 && submenu == 0 && status == -1 && Thread_Taper == 0) {   // the thread can't change under a running cycle
     if (! Enc2.digitalRead(Enc_Button)) {
       delay(200);
       if (Thread_Mode == 0) {
@@ -269,18 +402,20 @@ void Mode_2_SubMenu_Controls() {                              // Auto Thread Sub
     delay(200); 
     submenu = 1;
     Enc1.setEncoderPosition(submenu);
+    Job_Read(Mode_Array_Pos, Job_Pos, &Job_Current);                            // job page is the first page of the submenu
   }
 
   if (submenu >= 1) {    
     if (Enc1.getEncoderPosition() < submenu) { submenu++; Enc1.setEncoderPosition(submenu);}
     if (Enc1.getEncoderPosition() > submenu && submenu >= 2) { submenu--; Enc1.setEncoderPosition(submenu);}
     if (Enc1.getEncoderPosition() != submenu) {Enc1.setEncoderPosition(submenu);}
-    if (submenu > 3) { submenu = 0; Enc1.setEncoderPosition(Mode_Array_Pos);
+    if (submenu > 11) { submenu = 0; Enc1.setEncoderPosition(Mode_Array_Pos);
       Main_Menu(); Feed_Display.display(); delay(400);                          // reduces the chance of changing mode when leaving submenu
     }
   }
   
-  if (submenu == 1) {                                                           // submenu 1 thread length value adjustment
+  if (submenu == 1) {Job_Page_Controls();}                                      // submenu 1 job library
+  if (submenu == 2) {                                                           // submenu 2 thread length value adjustment
     //----Inch----//
     if (Thread_Mode == 0) {
       if (Enc2.getEncoderPosition() < 0) {
@@ -314,7 +449,7 @@ void Mode_2_SubMenu_Controls() {                              // Auto Thread Sub
       } 
     }
   }
-  if (submenu == 2) {                                                           // submenu 2 thread Diameter value adjustment
+  if (submenu == 3) {                                                           // submenu 3 thread Diameter value adjustment
     //----Inch----//
     if (Thread_Mode == 0) {
       if (Enc2.getEncoderPosition() < 0) {
@@ -348,7 +483,7 @@ void Mode_2_SubMenu_Controls() {                              // Auto Thread Sub
       } 
     }
   }
-  if (submenu == 3) {                                                           // submenu 3 thread Depth of cut value adjustment
+  if (submenu == 4) {                                                           // submenu 4 thread Depth of cut value adjustment
     //----Inch----//
     if (Thread_Mode == 0) {
       if (Enc2.getEncoderPosition() < 0) {
@@ -378,6 +513,36 @@ void Mode_2_SubMenu_Controls() {                              // Auto Thread Sub
       } 
     }
   }
+  if (submenu == 5 && status == -1) {                                           // submenu 5 starts, not while a thread is being cut
+    if (Enc2.getEncoderPosition() < 0 && Thread_Starts < Thread_Starts_Max) {Thread_Starts++;}
+    if (Enc2.getEncoderPosition() > 0 && Thread_Starts > 1) {Thread_Starts--;}
+    Enc2.setEncoderPosition(0);
+  }
+  if (submenu == 6 && status == -1) {                                           // submenu 6 straight or pipe thread
+    if (Enc2.getEncoderPosition() < 0 && Thread_Taper < Taper_Thread_Array_Size - 1) {Thread_Taper++; Pipe_Select();}
+    if (Enc2.getEncoderPosition() > 0 && Thread_Taper > 0) {Thread_Taper--; Pipe_Select();}
+    Enc2.setEncoderPosition(0);
+  }
+  if (submenu == 7 && status == -1 && Thread_Taper != 0) {                      // submenu 7 pipe size
+    if (Enc2.getEncoderPosition() < 0 && Pipe_Array_Pos < Pipe_Array_Size - 1) {Pipe_Array_Pos++; Pipe_Select();}
+    if (Enc2.getEncoderPosition() > 0 && Pipe_Array_Pos > 0) {Pipe_Array_Pos--; Pipe_Select();}
+    Enc2.setEncoderPosition(0);
+  }
+  if (submenu == 8 && status == -1) {                                           // submenu 8 right or left hand
+    if (Enc2.getEncoderPosition() < 0 && Thread_Hand < Hand_Array_Size - 1) {Thread_Hand++;}
+    if (Enc2.getEncoderPosition() > 0 && Thread_Hand > 0) {Thread_Hand--;}
+    Enc2.setEncoderPosition(0);
+  }
+  if (submenu == 9 && status == -1) {                                           // submenu 9 toward the headstock or the tailstock
+    if (Enc2.getEncoderPosition() < 0 && Direction_Array_Pos < Direction_Array_Size - 1) {Direction_Array_Pos++;}
+    if (Enc2.getEncoderPosition() > 0 && Direction_Array_Pos > 0) {Direction_Array_Pos--;}
+    Enc2.setEncoderPosition(0);
+  }
+  if (submenu == 10 && status == -1) {                                          // submenu 10 thread end pull out angle, 0 = off
+    Adjust_Value(&Thread_Pull_Angle, 1, 5, 15, 0);
+    if (Thread_Pull_Angle > Thread_Pull_Angle_Max) {Thread_Pull_Angle = Thread_Pull_Angle_Max;}
+  }
+  if (submenu == 11) {Cycle_Start_Stop();}                                      // submenu 11 start/stop
 }
 
 void Mode_3_SubMenu_Controls() {                              // Auto Turn Sub Menu
@@ -389,18 +554,20 @@ void Mode_3_SubMenu_Controls() {                              // Auto Turn Sub M
     delay(200); 
     submenu = 1;
     Enc1.setEncoderPosition(submenu);
+    Job_Read(Mode_Array_Pos, Job_Pos, &Job_Current);                            // job page is the first page of the submenu
   }
 
   if (submenu >= 1) {      
     if (Enc1.getEncoderPosition() < submenu) { submenu++; Enc1.setEncoderPosition(submenu);}
     if (Enc1.getEncoderPosition() > submenu && submenu >= 2) { submenu--; Enc1.setEncoderPosition(submenu);}
     if (Enc1.getEncoderPosition() != submenu) {Enc1.setEncoderPosition(submenu);}
-    if (submenu > 4) { submenu = 0; Enc1.setEncoderPosition(Mode_Array_Pos);
+    if (submenu > 5) { submenu = 0; Enc1.setEncoderPosition(Mode_Array_Pos);
        Main_Menu(); Feed_Display.display(); delay(400);                          // reduces the chance of changing mode when leaving submenu
     }
   }
   
-  if (submenu == 1) {                                                           // submenu 1 thread length value adjustment
+  if (submenu == 1) {Job_Page_Controls();}                                      // submenu 1 job library
+  if (submenu == 2) {                                                           // submenu 2 thread length value adjustment
     //----Inch----//
     if (Thread_Mode == 0) {
       if (Enc2.getEncoderPosition() < 0) {
@@ -434,7 +601,7 @@ void Mode_3_SubMenu_Controls() {                              // Auto Turn Sub M
       } 
     }
   }
-  if (submenu == 2) {                                                           // submenu 2 thread Diameter value adjustment
+  if (submenu == 3) {                                                           // submenu 3 thread Diameter value adjustment
     //----Inch----//
     if (Thread_Mode == 0) {
       if (Enc2.getEncoderPosition() < 0) {
@@ -468,7 +635,7 @@ void Mode_3_SubMenu_Controls() {                              // Auto Turn Sub M
       } 
     }
   }
-  if (submenu == 3) {                                                           // submenu 3 thread Final Diameter value adjustment
+  if (submenu == 4) {                                                           // submenu 4 thread Final Diameter value adjustment
     //----Inch----//
     if (Thread_Mode == 0) {
       if (Enc2.getEncoderPosition() < 0) {
@@ -498,7 +665,7 @@ void Mode_3_SubMenu_Controls() {                              // Auto Turn Sub M
       } 
     }
   }
-  if (submenu == 4) {                                                           // submenu 4 thread Depth of cut value adjustment
+  if (submenu == 5) {                                                           // submenu 5 thread Depth of cut value adjustment
     //----Inch----//
     if (Thread_Mode == 0) {
       if (Enc2.getEncoderPosition() < 0) {
@@ -539,18 +706,20 @@ void Mode_6_SubMenu_Controls() {                              // Auto Turn Sub M
     delay(200); 
     submenu = 1;
     Enc1.setEncoderPosition(submenu);
+    Job_Read(Mode_Array_Pos, Job_Pos, &Job_Current);                            // job page is the first page of the submenu
   }
 
   if (submenu >= 1) {      
     if (Enc1.getEncoderPosition() < submenu) { submenu++; Enc1.setEncoderPosition(submenu);}
     if (Enc1.getEncoderPosition() > submenu && submenu >= 2) { submenu--; Enc1.setEncoderPosition(submenu);}
     if (Enc1.getEncoderPosition() != submenu) {Enc1.setEncoderPosition(submenu);}
-    if (submenu > 5) { submenu = 0; Enc1.setEncoderPosition(Mode_Array_Pos);
+    if (submenu > 6) { submenu = 0; Enc1.setEncoderPosition(Mode_Array_Pos);
        Main_Menu(); Feed_Display.display(); delay(400);                          // reduces the chance of changing mode when leaving submenu
     }
   }
   
-  if (submenu == 1) {                                                           // submenu 1 radius type input
+  if (submenu == 1) {Job_Page_Controls();}                                      // submenu 1 job library
+  if (submenu == 2) {                                                           // submenu 2 radius type input
       if (Enc2.getEncoderPosition() < 0) {
         Radius_type = Radius_type + 1;
         if (Radius_type > 3) {Radius_type = 3;}
@@ -562,7 +731,7 @@ void Mode_6_SubMenu_Controls() {                              // Auto Turn Sub M
         Enc2.setEncoderPosition(0);
       } 
     }
-  if (submenu == 2) {                                                           // submenu 2 radius input
+  if (submenu == 3) {                                                           // submenu 3 radius input
     //----Inch----//
     if (Metric == 0) {
       double in_radius_old = in_Radius;
@@ -600,7 +769,7 @@ void Mode_6_SubMenu_Controls() {                              // Auto Turn Sub M
       if (mm_radius_old != mm_Radius) {Build_ZY = 0;}
     }
   }
-  if (submenu == 3) {                                                           // submenu 3 steps/resolution input
+  if (submenu == 4) {                                                           // submenu 4 steps/resolution input
     int old_steps = Radius_Steps;
     if (Enc2.getEncoderPosition() < 0) {
       Radius_Steps = Radius_Steps + 1;
@@ -616,7 +785,7 @@ void Mode_6_SubMenu_Controls() {                              // Auto Turn Sub M
     } 
     if (old_steps != Radius_Steps) {Build_ZY = 0;}
   }
-  if (submenu == 4) {                                                           // submenu 4 Depth of Cut input
+  if (submenu == 5) {                                                           // submenu 5 Depth of Cut input
     if (Metric == 0) {
       if (Enc2.getEncoderPosition() < 0) {
         in_DOC = in_DOC + .001;
@@ -647,7 +816,7 @@ void Mode_6_SubMenu_Controls() {                              // Auto Turn Sub M
 
     Cut_Pass();           //calculate the total cut passes
   } 
-  if (submenu == 5) {
+  if (submenu == 6) {
     start_or_stop();
   }
 }
@@ -655,4 +824,466 @@ void Mode_6_SubMenu_Controls() {                              // Auto Turn Sub M
 void start_or_stop() {
    if (! Enc2.digitalRead(Enc_Button) && status == -1) {status = 0;}  // start auto radius
     else {status = -1; LeadScrew.stop(); CrossSlide.stop();}           // stop auto radius at current position
-}
\ No newline at end of file
+}
+
+void Mode_7_Chamfer_Controls() {                              // Chamfer Mode
+//----Mode 7 (Chamfer) Controls----//
+  if (Mode_Array_Pos == 7 && submenu == 0) {
+    if (! Enc2.digitalRead(Enc_Button) && SpindleRPM == 0) {        //do stuff if Encoder button is pressed and spindle speed is zero
+      delay(200);
+      if (Measure_Array_Pos == 0) {
+        Measure_Array_Pos = 1;
+        Metric = 1;                               // set metric flag to 1 (Metric)
+      } else {
+        Measure_Array_Pos = 0;
+        Metric = 0;                               // set metric flag to 0 (Inch)
+      }
+    }
+    if (Metric == 0) {Adjust_Value(&In_FeedRate, .001, .014, 0, .001);}
+    if (Metric == 1) {Adjust_Value(&mm_FeedRate, .01, .09, 0, .01);}
+  }
+}
+
+void Mode_7_SubMenu_Controls() {                              // Chamfer Sub Menu
+  // use Enc1 button to activate sub menu
+  // use Enc1 encoder to traverse/exit menu
+  // use Enc2 encoder to modify values
+
+  if (! Enc1.digitalRead(Enc_Button) && Mode_Array_Pos == 7 && submenu == 0) {    // submenu button control
+    delay(200);
+    submenu = 1;
+    Enc1.setEncoderPosition(submenu);
+  }
+
+  if (submenu >= 1) {
+    if (Enc1.getEncoderPosition() < submenu) { submenu++; Enc1.setEncoderPosition(submenu);}
+    if (Enc1.getEncoderPosition() > submenu && submenu >= 2) { submenu--; Enc1.setEncoderPosition(submenu);}
+    if (Enc1.getEncoderPosition() != submenu) {Enc1.setEncoderPosition(submenu);}
+    if (submenu > 6) { submenu = 0; Enc1.setEncoderPosition(Mode_Array_Pos);
+       Main_Menu(); Feed_Display.display(); delay(400);                          // reduces the chance of changing mode when leaving submenu
+    }
+  }
+
+  if (submenu == 1) {                                                           // submenu 1 chamfer type
+    if (Enc2.getEncoderPosition() < 0) {
+      Chamfer_type = Chamfer_type + 1;
+      if (Chamfer_type > 3) {Chamfer_type = 3;}
+      Enc2.setEncoderPosition(0);
+    }
+    if (Enc2.getEncoderPosition() > 0) {
+      Chamfer_type = Chamfer_type - 1;
+      if (Chamfer_type < 0) {Chamfer_type = 0;}
+      Enc2.setEncoderPosition(0);
+    }
+  }
+  if (submenu == 2) {                                                           // submenu 2 chamfer size
+    if (Metric == 0) {Adjust_Value(&in_Chamfer_Size, .001, .01, .1, .001);}
+    if (Metric == 1) {Adjust_Value(&mm_Chamfer_Size, .01, .1, 1, .01);}
+  }
+  if (submenu == 3) {                                                           // submenu 3 chamfer angle
+    Adjust_Value(&Chamfer_Angle, .5, 4.5, 10, 1);
+    if (Chamfer_Angle > 89) {Chamfer_Angle = 89;}
+  }
+  if (submenu == 4) {                                                           // submenu 4 depth of cut
+    if (Metric == 0) {Adjust_Value(&in_DOC, .001, .01, 0, .001);}
+    if (Metric == 1) {Adjust_Value(&mm_DOC, .01, .1, 0, .01);}
+  }
+  if (submenu == 5) {                                                           // submenu 5 finish pass allowance
+    if (Metric == 0) {Adjust_Value(&final_pass_in, .001, .005, 0, 0);}
+    if (Metric == 1) {Adjust_Value(&final_pass_mm, .01, .1, 0, 0);}
+  }
+  if (submenu == 6) {Cycle_Start_Stop();}                                       // submenu 6 start/stop
+}
+
+void Mode_9_Taper_Controls() {                                // Taper Mode
+//----Mode 9 (Taper) Controls----//
+  if (Mode_Array_Pos == 9 && submenu == 0) {
+    if (! Enc2.digitalRead(Enc_Button) && SpindleRPM == 0) {        //do stuff if Encoder button is pressed and spindle speed is zero
+      delay(200);
+      if (Measure_Array_Pos == 0) {
+        Measure_Array_Pos = 1;
+        Metric = 1;                               // set metric flag to 1 (Metric)
+      } else {
+        Measure_Array_Pos = 0;
+        Metric = 0;                               // set metric flag to 0 (Inch)
+      }
+    }
+    if (Metric == 0) {Adjust_Value(&In_FeedRate, .001, .014, 0, .001);}
+    if (Metric == 1) {Adjust_Value(&mm_FeedRate, .01, .09, 0, .01);}
+  }
+}
+
+void Mode_9_SubMenu_Controls() {                              // Taper Sub Menu
+  // use Enc1 button to activate sub menu
+  // use Enc1 encoder to traverse/exit menu
+  // use Enc2 encoder to modify values
+
+  if (! Enc1.digitalRead(Enc_Button) && Mode_Array_Pos == 9 && submenu == 0) {    // submenu button control
+    delay(200);
+    submenu = 1;
+    Enc1.setEncoderPosition(submenu);
+  }
+
+  if (submenu >= 1) {
+    if (Enc1.getEncoderPosition() < submenu) { submenu++; Enc1.setEncoderPosition(submenu);}
+    if (Enc1.getEncoderPosition() > submenu && submenu >= 2) { submenu--; Enc1.setEncoderPosition(submenu);}
+    if (Enc1.getEncoderPosition() != submenu) {Enc1.setEncoderPosition(submenu);}
+    if (submenu > 7) { submenu = 0; Enc1.setEncoderPosition(Mode_Array_Pos);
+       Main_Menu(); Feed_Display.display(); delay(400);                          // reduces the chance of changing mode when leaving submenu
+    }
+  }
+
+  if (submenu == 1) {                                                           // submenu 1 taper type
+    if (Enc2.getEncoderPosition() < 0) {Taper_type = 1; Enc2.setEncoderPosition(0);}
+    if (Enc2.getEncoderPosition() > 0) {Taper_type = 0; Enc2.setEncoderPosition(0);}
+  }
+  if (submenu == 2) {                                                           // submenu 2 start diameter
+    if (Metric == 0) {Adjust_Value(&in_Outside_Diameter, .001, .01, .25, .001);}
+    if (Metric == 1) {Adjust_Value(&mm_Outside_Diameter, .01, .1, 1.5, .01);}
+  }
+  if (submenu == 3) {                                                           // submenu 3 end diameter or angle
+    if (Taper_type == 0 && Metric == 0) {Adjust_Value(&in_Final_Diameter, .001, .01, .25, .001);}
+    if (Taper_type == 0 && Metric == 1) {Adjust_Value(&mm_Final_Diameter, .01, .1, 1.5, .01);}
+    if (Taper_type == 1) {
+      Adjust_Value(&Taper_Angle, .1, .9, 4, -45);
+      if (Taper_Angle > 45) {Taper_Angle = 45;}
+    }
+  }
+  if (submenu == 4) {                                                           // submenu 4 taper length
+    if (Metric == 0) {Adjust_Value(&in_length_of_cut, .001, .01, .25, .001);}
+    if (Metric == 1) {Adjust_Value(&mm_length_of_cut, .01, .1, 1, .01);}
+  }
+  if (submenu == 5) {                                                           // submenu 5 depth of cut
+    if (Metric == 0) {Adjust_Value(&in_DOC, .001, .01, 0, .001);}
+    if (Metric == 1) {Adjust_Value(&mm_DOC, .01, .1, 0, .01);}
+  }
+  if (submenu == 6) {                                                           // submenu 6 finish pass allowance
+    if (Metric == 0) {Adjust_Value(&final_pass_in, .001, .005, 0, 0);}
+    if (Metric == 1) {Adjust_Value(&final_pass_mm, .01, .1, 0, 0);}
+  }
+  if (submenu == 7) {Cycle_Start_Stop();}                                       // submenu 7 start/stop
+}
+
+void Mode_10_Ball_Controls() {                                // Ball Mode
+//----Mode 10 (Ball) Controls----//
+  if (Mode_Array_Pos == 10 && submenu == 0) {
+    if (! Enc2.digitalRead(Enc_Button) && SpindleRPM == 0) {        //do stuff if Encoder button is pressed and spindle speed is zero
+      delay(200);
+      if (Measure_Array_Pos == 0) {
+        Measure_Array_Pos = 1;
+        Metric = 1;                               // set metric flag to 1 (Metric)
+      } else {
+        Measure_Array_Pos = 0;
+        Metric = 0;                               // set metric flag to 0 (Inch)
+      }
+    }
+    if (Metric == 0) {Adjust_Value(&In_FeedRate, .001, .014, 0, .001);}
+    if (Metric == 1) {Adjust_Value(&mm_FeedRate, .01, .09, 0, .01);}
+  }
+}
+
+void Mode_10_SubMenu_Controls() {                             // Ball Sub Menu
+  // use Enc1 button to activate sub menu
+  // use Enc1 encoder to traverse/exit menu
+  // use Enc2 encoder to modify values
+
+  if (! Enc1.digitalRead(Enc_Button) && Mode_Array_Pos == 10 && submenu == 0) {   // submenu button control
+    delay(200);
+    submenu = 1;
+    Enc1.setEncoderPosition(submenu);
+  }
+
+  if (submenu >= 1) {
+    if (Enc1.getEncoderPosition() < submenu) { submenu++; Enc1.setEncoderPosition(submenu);}
+    if (Enc1.getEncoderPosition() > submenu && submenu >= 2) { submenu--; Enc1.setEncoderPosition(submenu);}
+    if (Enc1.getEncoderPosition() != submenu) {Enc1.setEncoderPosition(submenu);}
+    if (submenu > 7) { submenu = 0; Enc1.setEncoderPosition(Mode_Array_Pos);
+       Main_Menu(); Feed_Display.display(); delay(400);                          // reduces the chance of changing mode when leaving submenu
+    }
+  }
+
+  if (submenu == 1) {                                                           // submenu 1 hemisphere or full sphere
+    if (Enc2.getEncoderPosition() < 0) {Ball_type = 1; Enc2.setEncoderPosition(0);}
+    if (Enc2.getEncoderPosition() > 0) {Ball_type = 0; Enc2.setEncoderPosition(0);}
+  }
+  if (submenu == 2) {                                                           // submenu 2 stock diameter
+    if (Metric == 0) {Adjust_Value(&in_Outside_Diameter, .001, .01, .25, .001);}
+    if (Metric == 1) {Adjust_Value(&mm_Outside_Diameter, .01, .1, 1.5, .01);}
+  }
+  if (submenu == 3) {                                                           // submenu 3 ball diameter
+    if (Metric == 0) {Adjust_Value(&in_Ball_Diameter, .001, .01, .25, .01);}
+    if (Metric == 1) {Adjust_Value(&mm_Ball_Diameter, .01, .1, 1.5, .1);}
+  }
+  if (submenu == 4) {                                                           // submenu 4 neck diameter
+    if (Metric == 0) {Adjust_Value(&in_Ball_Neck, .001, .01, .25, 0);}
+    if (Metric == 1) {Adjust_Value(&mm_Ball_Neck, .01, .1, 1.5, 0);}
+  }
+  if (submenu == 5) {                                                           // submenu 5 depth of cut
+    if (Metric == 0) {Adjust_Value(&in_DOC, .001, .01, 0, .001);}
+    if (Metric == 1) {Adjust_Value(&mm_DOC, .01, .1, 0, .01);}
+  }
+  if (submenu == 6) {                                                           // submenu 6 finish pass allowance
+    if (Metric == 0) {Adjust_Value(&final_pass_in, .001, .005, 0, 0);}
+    if (Metric == 1) {Adjust_Value(&final_pass_mm, .01, .1, 0, 0);}
+  }
+  if (submenu == 7) {Cycle_Start_Stop();}                                       // submenu 7 start/stop
+}
+
+void Mode_11_Face_Controls() {                                // Face Mode
+//----Mode 11 (Face) Controls----//
+  if (Mode_Array_Pos == 11 && submenu == 0) {
+    if (! Enc2.digitalRead(Enc_Button) && SpindleRPM == 0) {        //do stuff if Encoder button is pressed and spindle speed is zero
+      delay(200);
+      if (Measure_Array_Pos == 0) {
+        Measure_Array_Pos = 1;
+        Metric = 1;                               // set metric flag to 1 (Metric)
+      } else {
+        Measure_Array_Pos = 0;
+        Metric = 0;                               // set metric flag to 0 (Inch)
+      }
+    }
+    if (Face_type == 0 && Metric == 0) {Adjust_Value(&In_FeedRate, .001, .014, 0, .001);}
+    if (Face_type == 0 && Metric == 1) {Adjust_Value(&mm_FeedRate, .01, .09, 0, .01);}
+    if (Face_type == 1 && Metric == 0) {Adjust_Value(&in_Face_Rate, .01, .09, .9, .01);}     // per minute
+    if (Face_type == 1 && Metric == 1) {Adjust_Value(&mm_Face_Rate, .1, .9, 9, .1);}
+  }
+}
+
+void Mode_11_SubMenu_Controls() {                             // Face Sub Menu
+  // use Enc1 button to activate sub menu
+  // use Enc1 encoder to traverse/exit menu
+  // use Enc2 encoder to modify values
+
+  if (! Enc1.digitalRead(Enc_Button) && Mode_Array_Pos == 11 && submenu == 0) {   // submenu button control
+    delay(200);
+    submenu = 1;
+    Enc1.setEncoderPosition(submenu);
+  }
+
+  if (submenu >= 1) {
+    if (Enc1.getEncoderPosition() < submenu) { submenu++; Enc1.setEncoderPosition(submenu);}
+    if (Enc1.getEncoderPosition() > submenu && submenu >= 2) { submenu--; Enc1.setEncoderPosition(submenu);}
+    if (Enc1.getEncoderPosition() != submenu) {Enc1.setEncoderPosition(submenu);}
+    if (submenu > 6) { submenu = 0; Enc1.setEncoderPosition(Mode_Array_Pos);
+       Main_Menu(); Feed_Display.display(); delay(400);                          // reduces the chance of changing mode when leaving submenu
+    }
+  }
+
+  if (submenu == 1) {                                                           // submenu 1 feed per rev or per minute
+    if (Enc2.getEncoderPosition() < 0) {Face_type = 1; Enc2.setEncoderPosition(0);}
+    if (Enc2.getEncoderPosition() > 0) {Face_type = 0; Enc2.setEncoderPosition(0);}
+  }
+  if (submenu == 2) {                                                           // submenu 2 stock diameter
+    if (Metric == 0) {Adjust_Value(&in_Outside_Diameter, .001, .01, .25, .001);}
+    if (Metric == 1) {Adjust_Value(&mm_Outside_Diameter, .01, .1, 1.5, .01);}
+  }
+  if (submenu == 3) {                                                           // submenu 3 stock off the face
+    if (Metric == 0) {Adjust_Value(&in_Face_Depth, .001, .01, .1, .001);}
+    if (Metric == 1) {Adjust_Value(&mm_Face_Depth, .01, .1, 1, .01);}
+  }
+  if (submenu == 4) {                                                           // submenu 4 depth of cut
+    if (Metric == 0) {Adjust_Value(&in_DOC, .001, .01, 0, .001);}
+    if (Metric == 1) {Adjust_Value(&mm_DOC, .01, .1, 0, .01);}
+  }
+  if (submenu == 5) {                                                           // submenu 5 finish pass allowance
+    if (Metric == 0) {Adjust_Value(&final_pass_in, .001, .005, 0, 0);}
+    if (Metric == 1) {Adjust_Value(&final_pass_mm, .01, .1, 0, 0);}
+  }
+  if (submenu == 6) {Cycle_Start_Stop();}                                       // submenu 6 start/stop
+}
+
+void Mode_12_Part_Controls() {                                // Parting Mode
+//----Mode 12 (Parting) Controls----//
+  if (Mode_Array_Pos == 12 && submenu == 0) {
+    if (! Enc2.digitalRead(Enc_Button) && SpindleRPM == 0) {        //do stuff if Encoder button is pressed and spindle speed is zero
+      delay(200);
+      if (Measure_Array_Pos == 0) {
+        Measure_Array_Pos = 1;
+        Metric = 1;                               // set metric flag to 1 (Metric)
+      } else {
+        Measure_Array_Pos = 0;
+        Metric = 0;                               // set metric flag to 0 (Inch)
+      }
+    }
+    if (Metric == 0) {Adjust_Value(&In_FeedRate, .001, .014, 0, .001);}
+    if (Metric == 1) {Adjust_Value(&mm_FeedRate, .01, .09, 0, .01);}
+  }
+}
+
+void Mode_12_SubMenu_Controls() {                             // Parting Sub Menu
+  // use Enc1 button to activate sub menu
+  // use Enc1 encoder to traverse/exit menu
+  // use Enc2 encoder to modify values
+
+  if (! Enc1.digitalRead(Enc_Button) && Mode_Array_Pos == 12 && submenu == 0) {   // submenu button control
+    delay(200);
+    submenu = 1;
+    Enc1.setEncoderPosition(submenu);
+  }
+
+  if (submenu >= 1) {
+    if (Enc1.getEncoderPosition() < submenu) { submenu++; Enc1.setEncoderPosition(submenu);}
+    if (Enc1.getEncoderPosition() > submenu && submenu >= 2) { submenu--; Enc1.setEncoderPosition(submenu);}
+    if (Enc1.getEncoderPosition() != submenu) {Enc1.setEncoderPosition(submenu);}
+    if (submenu > 5) { submenu = 0; Enc1.setEncoderPosition(Mode_Array_Pos);
+       Main_Menu(); Feed_Display.display(); delay(400);                          // reduces the chance of changing mode when leaving submenu
+    }
+  }
+
+  if (submenu == 1) {                                                           // submenu 1 stock diameter
+    if (Metric == 0) {Adjust_Value(&in_Outside_Diameter, .001, .01, .25, .001);}
+    if (Metric == 1) {Adjust_Value(&mm_Outside_Diameter, .01, .1, 1.5, .01);}
+  }
+  if (submenu == 2) {                                                           // submenu 2 diameter to stop at
+    if (Metric == 0) {Adjust_Value(&in_Part_Diameter, .001, .01, .25, 0);}
+    if (Metric == 1) {Adjust_Value(&mm_Part_Diameter, .01, .1, 1.5, 0);}
+  }
+  if (submenu == 3) {                                                           // submenu 3 revs between pecks, 0 = off
+    if (Enc2.getEncoderPosition() < 0) {
+      Part_Peck_Revs = Part_Peck_Revs + 1;
+      if (Part_Peck_Revs > 100) {Part_Peck_Revs = 100;}
+      Enc2.setEncoderPosition(0);
+    }
+    if (Enc2.getEncoderPosition() > 0) {
+      Part_Peck_Revs = Part_Peck_Revs - 1;
+      if (Part_Peck_Revs < 0) {Part_Peck_Revs = 0;}
+      Enc2.setEncoderPosition(0);
+    }
+  }
+  if (submenu == 4) {                                                           // submenu 4 peck retract
+    if (Metric == 0) {Adjust_Value(&in_Part_Retract, .001, .01, 0, .001);}
+    if (Metric == 1) {Adjust_Value(&mm_Part_Retract, .01, .1, 0, .01);}
+  }
+  if (submenu == 5) {Cycle_Start_Stop();}                                       // submenu 5 start/stop
+}
+
+void Mode_13_Groove_Controls() {                              // Groove Mode
+//----Mode 13 (Groove) Controls----//
+  if (Mode_Array_Pos == 13 && submenu == 0) {
+    if (! Enc2.digitalRead(Enc_Button) && SpindleRPM == 0) {        //do stuff if Encoder button is pressed and spindle speed is zero
+      delay(200);
+      if (Measure_Array_Pos == 0) {
+        Measure_Array_Pos = 1;
+        Metric = 1;                               // set metric flag to 1 (Metric)
+      } else {
+        Measure_Array_Pos = 0;
+        Metric = 0;                               // set metric flag to 0 (Inch)
+      }
+    }
+    if (Metric == 0) {Adjust_Value(&In_FeedRate, .001, .014, 0, .001);}
+    if (Metric == 1) {Adjust_Value(&mm_FeedRate, .01, .09, 0, .01);}
+  }
+}
+
+void Mode_13_SubMenu_Controls() {                             // Groove Sub Menu
+  // use Enc1 button to activate sub menu
+  // use Enc1 encoder to traverse/exit menu
+  // use Enc2 encoder to modify values
+
+  if (! Enc1.digitalRead(Enc_Button) && Mode_Array_Pos == 13 && submenu == 0) {   // submenu button control
+    delay(200);
+    submenu = 1;
+    Enc1.setEncoderPosition(submenu);
+  }
+
+  if (submenu >= 1) {
+    if (Enc1.getEncoderPosition() < submenu) { submenu++; Enc1.setEncoderPosition(submenu);}
+    if (Enc1.getEncoderPosition() > submenu && submenu >= 2) { submenu--; Enc1.setEncoderPosition(submenu);}
+    if (Enc1.getEncoderPosition() != submenu) {Enc1.setEncoderPosition(submenu);}
+    if (submenu > 7) { submenu = 0; Enc1.setEncoderPosition(Mode_Array_Pos);
+       Main_Menu(); Feed_Display.display(); delay(400);                          // reduces the chance of changing mode when leaving submenu
+    }
+  }
+
+  if (submenu == 1) {                                                           // submenu 1 end face to the groove
+    if (Metric == 0) {Adjust_Value(&in_Groove_Position, .001, .01, .25, 0);}
+    if (Metric == 1) {Adjust_Value(&mm_Groove_Position, .01, .1, 1.5, 0);}
+  }
+  if (submenu == 2) {                                                           // submenu 2 groove width
+    if (Metric == 0) {Adjust_Value(&in_Groove_Width, .001, .01, .1, .001);}
+    if (Metric == 1) {Adjust_Value(&mm_Groove_Width, .01, .1, 1, .01);}
+  }
+  if (submenu == 3) {                                                           // submenu 3 groove depth
+    if (Metric == 0) {Adjust_Value(&in_Groove_Depth, .001, .01, .1, .001);}
+    if (Metric == 1) {Adjust_Value(&mm_Groove_Depth, .01, .1, 1, .01);}
+  }
+  if (submenu == 4) {                                                           // submenu 4 tool width
+    if (Metric == 0) {Adjust_Value(&in_Groove_Tool, .001, .01, 0, .001);}
+    if (Metric == 1) {Adjust_Value(&mm_Groove_Tool, .01, .1, 0, .01);}
+  }
+  if (submenu == 5) {Adjust_Value(&Groove_Dwell, .5, 1, 5, 0);}               // submenu 5 dwell revs
+  if (submenu == 6) {                                                           // submenu 6 finish pass allowance
+    if (Metric == 0) {Adjust_Value(&final_pass_in, .001, .005, 0, 0);}
+    if (Metric == 1) {Adjust_Value(&final_pass_mm, .01, .1, 0, 0);}
+  }
+  if (submenu == 7) {Cycle_Start_Stop();}                                       // submenu 7 start/stop
+}
+
+void Mode_14_Polygon_Controls() {                             // Polygon Mode
+//----Mode 14 (Polygon) Controls----//
+  if (Mode_Array_Pos == 14 && submenu == 0) {
+    if (! Enc2.digitalRead(Enc_Button) && SpindleRPM == 0) {        //do stuff if Encoder button is pressed and spindle speed is zero
+      delay(200);
+      if (Measure_Array_Pos == 0) {
+        Measure_Array_Pos = 1;
+        Metric = 1;                               // set metric flag to 1 (Metric)
+      } else {
+        Measure_Array_Pos = 0;
+        Metric = 0;                               // set metric flag to 0 (Inch)
+      }
+    }
+    if (Metric == 0) {Adjust_Value(&In_FeedRate, .001, .014, 0, .001);}
+    if (Metric == 1) {Adjust_Value(&mm_FeedRate, .01, .09, 0, .01);}
+  }
+}
+
+void Mode_14_SubMenu_Controls() {                             // Polygon Sub Menu
+  // use Enc1 button to activate sub menu
+  // use Enc1 encoder to traverse/exit menu
+  // use Enc2 encoder to modify values
+
+  if (! Enc1.digitalRead(Enc_Button) && Mode_Array_Pos == 14 && submenu == 0) {   // submenu button control
+    delay(200);
+    submenu = 1;
+    Enc1.setEncoderPosition(submenu);
+  }
+
+  if (submenu >= 1) {
+    if (Enc1.getEncoderPosition() < submenu) { submenu++; Enc1.setEncoderPosition(submenu);}
+    if (Enc1.getEncoderPosition() > submenu && submenu >= 2) { submenu--; Enc1.setEncoderPosition(submenu);}
+    if (Enc1.getEncoderPosition() != submenu) {Enc1.setEncoderPosition(submenu);}
+    if (submenu > 6) { submenu = 0; Enc1.setEncoderPosition(Mode_Array_Pos);
+       Main_Menu(); Feed_Display.display(); delay(400);                          // reduces the chance of changing mode when leaving submenu
+    }
+  }
+
+  if (submenu == 1) {                                                           // submenu 1 polygon or eccentric
+    if (Enc2.getEncoderPosition() < 0) {Polygon_type = 1; Enc2.setEncoderPosition(0);}
+    if (Enc2.getEncoderPosition() > 0) {Polygon_type = 0; Enc2.setEncoderPosition(0);}
+  }
+  if (submenu == 2) {                                                           // submenu 2 number of sides
+    if (Enc2.getEncoderPosition() < 0) {
+      Polygon_Sides = Polygon_Sides + 1;
+      if (Polygon_Sides > 12) {Polygon_Sides = 12;}
+      Enc2.setEncoderPosition(0);
+    }
+    if (Enc2.getEncoderPosition() > 0) {
+      Polygon_Sides = Polygon_Sides - 1;
+      if (Polygon_Sides < 3) {Polygon_Sides = 3;}
+      Enc2.setEncoderPosition(0);
+    }
+  }
+  if (submenu == 3) {                                                           // submenu 3 across flats or eccentric diameter
+    if (Metric == 0) {Adjust_Value(&in_Polygon_Size, .001, .01, .25, .01);}
+    if (Metric == 1) {Adjust_Value(&mm_Polygon_Size, .01, .1, 1.5, .1);}
+  }
+  if (submenu == 4) {                                                           // submenu 4 eccentric offset
+    if (Metric == 0) {Adjust_Value(&in_Polygon_Offset, .001, .01, .1, 0);}
+    if (Metric == 1) {Adjust_Value(&mm_Polygon_Offset, .01, .1, 1, 0);}
+  }
+  if (submenu == 5) {                                                           // submenu 5 length
+    if (Metric == 0) {Adjust_Value(&in_Polygon_Length, .001, .01, .25, 0);}
+    if (Metric == 1) {Adjust_Value(&mm_Polygon_Length, .01, .1, 1.5, 0);}
+  }
+  if (submenu == 6) {Cycle_Start_Stop();}                                       // submenu 6 start/stop
+}
@@ -9,12 +9,22 @@ void RPM_Calc() {   //calculate RPM w/fastest optimizations
   sei();    //re-enable interrupts
 
   SpindleChange = newSpindle - oldSpindle;
+  SpindleRPM = Spindle_RPM_From_Counts(SpindleChange);
+  if (SpindleChange > 0) {S_Dir = 1;}                   // counting up is forward, the way Feed and Thread mode feed
+  else if (SpindleChange < 0) {S_Dir = 0;}
+  else {S_Dir = 2;}
+  oldSpindle = newSpindle;
+}
+
+/** @brief Converts the encoder counts seen over one RPM_Check interval to RPM
+    @param SpindleChange  : encoder counts since the last RPM check
+*/
+double Spindle_RPM_From_Counts(long long SpindleChange) {
   double num;
   double den;
   num = (60000*SpindleChange);
   den = (SpindleCPR*(RPM_Check_INTERVAL_MS/1000));
-  SpindleRPM = num/den;
-  oldSpindle = newSpindle;
+  return num/den;
 }
 
 //----This is polled when a specific angle is needed to be stored----//
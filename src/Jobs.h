@@ -0,0 +1,151 @@
+/**
+  @brief Mounts the job library on the program flash
+*/
+void Job_Begin() {
+  Job_FS_Ready = Job_FS.begin(Job_FS_Size);
+  for (int i = 0; i < 2; i++) {
+    if (Job_FS_Ready && Job_FS.exists(Job_File_Old[i])) {Job_FS.remove(Job_File_Old[i]);}   // no version to tell what their records hold
+  }
+  Job_Current.Used = 0;
+}
+
+/** @brief Reads one job, returns false if the slot is empty, damaged or holds a job saved with another
+           Settings_Payload, which is skipped like Settings_Load() skips a record of another version
+    @param Job_Mode  : Mode_Array_Pos the job belongs to
+    @param Slot      : job slot 0 to Job_Slots-1
+    @param Job       : record read from the library
+*/
+bool Job_Read(int Job_Mode, int Slot, Job_Record *Job) {
+  Job->Used = 0;
+  if (Job_FS_Ready == 0) {return false;}
+  File Jobs = Job_FS.open(Job_File, FILE_READ);
+  if (!Jobs) {return false;}
+  uint32_t Offset = (Job_Mode * Job_Slots + Slot) * Job_Record_Size;
+  bool Found = Jobs.seek(Offset) && Jobs.read(Job, sizeof(Job_Record)) == sizeof(Job_Record);
+  Jobs.close();
+  if (!Found || Job->Used != Job_Used) {Job->Used = 0; return false;}
+  if (Job->Version != Settings_Version || Job->Size != sizeof(Settings_Payload)) {Job->Used = 0; return false;}   // CRC is not even in the same place
+  if (Job->CRC != CRC16((const uint8_t *)Job, sizeof(Job_Record) - sizeof(Job->CRC))) {Job->Used = 0; return false;}
+  return true;
+}
+
+/** @brief Writes one job record into its fixed place in the library
+    @param Job_Mode  : Mode_Array_Pos the job belongs to
+    @param Slot      : job slot 0 to Job_Slots-1
+    @param Job       : record to write
+*/
+void Job_Write(int Job_Mode, int Slot, const Job_Record *Job) {
+  if (Job_FS_Ready == 0) {return;}
+  File Jobs = Job_FS.open(Job_File, FILE_WRITE);
+  if (!Jobs) {return;}
+  uint32_t Offset = (Job_Mode * Job_Slots + Slot) * Job_Record_Size;
+  if (Jobs.size() < Offset) {                         // pad skipped slots so every job keeps a fixed offset
+    Jobs.seek(Jobs.size());
+    uint8_t Empty = 0;
+    for (uint32_t i = Jobs.size(); i < Offset; i++) {Jobs.write(&Empty, 1);}
+  }
+  Jobs.seek(Offset);
+  Jobs.write(Job, sizeof(Job_Record));
+  Jobs.close();
+}
+
+/** @brief Saves the current parameters as a job of the current mode
+    @param Slot  : job slot 0 to Job_Slots-1
+*/
+void Job_Store(int Slot) {
+  Job_Record Job;
+  memset(&Job, 0, sizeof(Job_Record));
+  Job.Used = Job_Used;
+  Job.Version = Settings_Version;
+  Job.Size = sizeof(Settings_Payload);
+  Job_Name(Job.Name);
+  Settings_Pack(&Job.Data);
+  Job.CRC = CRC16((const uint8_t *)&Job, sizeof(Job_Record) - sizeof(Job.CRC));
+  Job_Write(Mode_Array_Pos, Slot, &Job);
+  Job_Current = Job;
+}
+
+/** @brief Loads every parameter of a job and the values worked out from them.  Positions are left alone, a radius
+           job is planned from where the tool is by the normal Auto_Radius() start
+    @param Job  : job to load
+*/
+void Job_Recall(const Job_Record *Job) {
+  Settings_Unpack(&Job->Data);
+  TPI = TPI_Array[TPI_Array_Pos];
+  Pitch = Pitch_Array[Pitch_Array_Pos];
+  if (Mode_Array_Pos == 2) {                          // Auto Thread
+    Auto_Thread_Depth();
+  }
+  if (Mode_Array_Pos == 6) {                          // Radius
+    Build_ZY = 0;
+    Cut_Pass();
+  }
+}
+
+/** @brief Builds a short job name from the parameters that matter for the current mode
+    @param Name  : Job_Name_Size characters
+*/
+void Job_Name(char *Name) {
+  const char *Radius_Names[4] = {"LCvx", "RCvx", "LCcv", "RCcv"};
+  if (Mode_Array_Pos == 2 && Thread_Taper != 0) {
+    snprintf(Name, Job_Name_Size, "%s %s", Taper_Thread_Array[Thread_Taper].c_str(), Pipe_Array[Pipe_Array_Pos].c_str());
+  }
+  else if (Mode_Array_Pos == 2) {
+    if (Thread_Mode == 0) {snprintf(Name, Job_Name_Size, "%dTPI L%.3f", TPI_Array[TPI_Array_Pos], in_length_of_cut);}
+    else {snprintf(Name, Job_Name_Size, "P%.2f L%.2f", Pitch_Array[Pitch_Array_Pos], mm_length_of_cut);}
+  }
+  else if (Mode_Array_Pos == 3) {
+    if (Metric == 0) {snprintf(Name, Job_Name_Size, "%.3f>%.3f", in_Outside_Diameter, in_Final_Diameter);}
+    else {snprintf(Name, Job_Name_Size, "%.2f>%.2f", mm_Outside_Diameter, mm_Final_Diameter);}
+  }
+  else if (Mode_Array_Pos == 6) {
+    if (Metric == 0) {snprintf(Name, Job_Name_Size, "R%.3f %s", in_Radius, Radius_Names[Radius_type]);}
+    else {snprintf(Name, Job_Name_Size, "R%.2f %s", mm_Radius, Radius_Names[Radius_type]);}
+  }
+  else {snprintf(Name, Job_Name_Size, "%s", Mode_Array[Mode_Array_Pos].c_str());}
+}
+
+/** @brief Job library submenu page, shared by every mode with a submenu */
+void Job_Page() {
+  Feed_Display.setCursor(0,45);
+  Feed_Display.println("   Job");
+  Feed_Display.setCursor(0,65);
+  Feed_Display.print("  "); Feed_Display.print(Job_Pos + 1); Feed_Display.print("/"); Feed_Display.println(Job_Slots);
+  Feed_Display.setTextSize(1);
+  Feed_Display.setCursor(0,100);
+  if (Job_Current.Used == Job_Used) {Feed_Display.print(" "); Feed_Display.println(Job_Current.Name);}
+  else {Feed_Display.println(" Empty");}
+  Feed_Display.setCursor(0,115);
+  Feed_Display.println(" Press load/hold save");
+}
+
+/**
+  @brief Job page controls, turning Enc2 steps through the jobs and only shows each one, pressing Enc2 loads the
+         job shown, holding it for Job_Hold_Time saves the current parameters into the slot shown.  The press is
+         timed across passes, nothing here waits on the button
+*/
+void Job_Page_Controls() {
+  int Old_Pos = Job_Pos;
+  if (Enc2.getEncoderPosition() < 0) {
+    Job_Pos++;
+    if (Job_Pos >= Job_Slots) {Job_Pos = Job_Slots - 1;}                      // keeps job position inside the library
+    Enc2.setEncoderPosition(0);
+  }
+  if (Enc2.getEncoderPosition() > 0) {
+    Job_Pos--;
+    if (Job_Pos < 0) {Job_Pos = 0;}
+    Enc2.setEncoderPosition(0);
+  }
+  if (Old_Pos != Job_Pos) {Job_Read(Mode_Array_Pos, Job_Pos, &Job_Current);}  // name for the page, nothing is loaded
+
+  int Edge = Enc2_Button_Edge();
+  if (Edge == 1) {Job_Press = 1;}
+  if (Job_Press == 1 && Enc2_Button_Down == 1 && millis() - Enc2_Button_Time >= Job_Hold_Time) {     // held, save
+    Job_Store(Job_Pos);
+    Job_Press = 0;
+  }
+  if (Edge == -1 && Job_Press == 1) {                                         // let go before the hold time, load
+    if (Job_Current.Used == Job_Used) {Job_Recall(&Job_Current);}
+    Job_Press = 0;
+  }
+}
@@ -3,6 +3,8 @@
 //using: https://www.pjrc.com/teensy/td_timing_IntervalTimer.html
 
 void setup() {
+  Settings_Restore();               // bring back the settings from the last session before anything uses them
+  Job_Begin();                      // mount the job library
   Mode = Mode_Array_Pos;
   TPI = TPI_Array[TPI_Array_Pos];
   Pitch = Pitch_Array[Pitch_Array_Pos];
@@ -11,22 +13,24 @@ void setup() {
 
   spindle.setInitConfig();  //start spindle encoder
   spindle.init();
+  Axis_Encoder_Begin();             // leadscrew and cross slide encoders, when fitted
 
 //----Stepper Setup----//
   //----Leadscrew----//
     LeadSpeed = MaxLeadRPM * LeadSPR / 60;         // Leadscrew Max Steps/sec
-    LeadScrew.setMinPulseWidth(Step_Pulse_Width);
     LeadScrew.setMaxSpeed(LeadSpeed);
+    LeadScrew.setAcceleration(LeadSpeed / Rapid_Ramp_Time);    // only used by accelerated rapids
   //----Cross Slide----//
     Cross_Speed = MaxCrossRPM * CrossSPR / 60;         // CrossSlide Max Steps/sec
-    CrossSlide.setMinPulseWidth(Step_Pulse_Width);
     CrossSlide.setMaxSpeed(Cross_Speed);
+    CrossSlide.setAcceleration(Cross_Speed / Rapid_Ramp_Time);
   //----MultiStepper Setup----//
     ZY_Steppers.addStepper(LeadScrew);
     ZY_Steppers.addStepper(CrossSlide);
 
 //----Setup Various Display Methods----//
   Serial.begin(115200);             // starts serial
+  Protocol_Decoder_Reset(&Protocol_Rx);
   Wire.begin();                     // starts I2C
     Wire.setSDA(SDA_Pin);           //setting up I2C Pins, if others are needed setup Wire1, Wire2, etc
     Wire.setSCL(SCL_Pin);   
@@ -42,7 +46,7 @@ void setup() {
     Enc1_Pos = Enc1.getEncoderPosition();     // get starting position
   Enc2.begin(0x37);
     Enc2_Pos = Enc2.getEncoderPosition();       
-  Enc1.setEncoderPosition(Menu_pos);
+  Enc1.setEncoderPosition(Mode_Array_Pos);   // start on the restored mode
   Enc1.setGPIOInterrupts(Enc_Button, 1);
   //Enc1.enableEncoderInterrupt();
   Enc2.setGPIOInterrupts(Enc_Button, 1);
@@ -50,6 +54,13 @@ void setup() {
  
 //----Timer Setup----// 
   RPM_Check.begin(RPM_Calc, RPM_Check_INTERVAL_MS);       // Sets up an interrupt timer to run every "RPM_Check_INTERVAL_MS" (milli)
+  Sync_Z_Rate = LeadSpeed * Step_Tick_US;                 // synchronized moves keep to the same max speeds as AccelStepper
+  Sync_X_Rate = Cross_Speed * Step_Tick_US;
+  Output_Configure();
+  Comp_Begin(&Lead_Out, Lead_Comp_Table, Lead_Comp_Points, Lead_Comp_Spacing, Lead_Comp_Start);          // pitch error tables, read from the power up position
+  Comp_Begin(&Cross_Out, Cross_Comp_Table, Cross_Comp_Points, Cross_Comp_Spacing, Cross_Comp_Start);
+  Step_Timer.begin(Step_Tick, Step_Tick_US);              // step output for both axes, runs the spindle synchronized step generator first
+  Telemetry_Timer.begin(Telemetry_Sample, Telemetry_Period_US);   // motion samples, idle until the host subscribes to Stream_Motion
   Refresh_Rate_Timer.begin(Refresh, Refresh_Rate);        // Display Refresh Rate
   S_Timer.interval((124/60)*1000);
   S_Timer.reset();
@@ -69,18 +80,33 @@ void loop() {
     Serial.print("  "); Serial.println(LeadScrew.speed(),DEC);
   }*/
 
+  Follow_Update();                                  // following error, feed hold and retract
+  Soft_Stop_Plan();                                 // slow down ahead of the soft stops for the speed now
+  Axis_Encoder_Check();                             // lost steps, when axis encoders are fitted
+
 //----Feature/Mode Sub Routines----//             Proper Accelstepper run command for each feature
-  if (Mode_Array_Pos == 0) {Feed();               LeadScrew.runSpeed();} 
-  if (Mode_Array_Pos == 1) {Thread();             LeadScrew.runSpeed();} 
-  if (Mode_Array_Pos == 2) {Auto_Thread();        ZY_Steppers.run();}
+  if (Mode_Array_Pos > 1 && Sync_Endless == 1) {Sync_Stop();}        // Feed and Thread mode's spindle lock ends with the mode
+  if (Mode_Array_Pos != 14 && Sync_Profile_On == 1) {Sync_Stop(); status = -1;}   // so does a polygon cut
+  if (Mode_Array_Pos == 0) {Feed();}                                    // the leadscrew is stepped by Sync_Step()
+  if (Mode_Array_Pos == 1) {Thread();}                                  // the leadscrew is stepped by Sync_Step()
+  if (Mode_Array_Pos == 2) {Auto_Thread();        ZY_Steppers.run();}   // thread cuts are synchronized segments, stepped by Sync_Step()
   if (Mode_Array_Pos == 3) {Turn_to_Diameter();   ZY_Steppers.run();}
   if (Mode_Array_Pos == 4) {Manual_Z();           LeadScrew.run();}
   if (Mode_Array_Pos == 5) {Manual_X();           CrossSlide.run();}
   if (Mode_Array_Pos == 6) {Auto_Radius();        ZY_Steppers.run();}
-  if (Mode_Array_Pos == 7) {Chamfer();            ZY_Steppers.run();}
-  //if (Mode_Array_Pos == 8) {Taper();              ZY_Steppers.run();}
-  //if (Mode_Array_Pos == 9) {Knurling();           ZY_Steppers.run();}
-  //if (Mode_Array_Pos == 10) {Test_Menu();         ZY_Steppers.run();}
+  if (Mode_Array_Pos == 7) {Chamfer();            ZY_Steppers.run();}   // feeds are synchronized segments, stepped by Sync_Step()
+  if (Mode_Array_Pos == 8) {G_Code();             ZY_Steppers.run();}   // synchronized segments are stepped by Sync_Step()
+  if (Mode_Array_Pos == 9) {Taper();              ZY_Steppers.run();}   // feeds are synchronized segments, stepped by Sync_Step()
+  if (Mode_Array_Pos == 10) {Ball();              ZY_Steppers.run();}   // feeds are synchronized segments, stepped by Sync_Step()
+  if (Mode_Array_Pos == 11) {Face();              ZY_Steppers.run();}   // feeds per rev are synchronized segments, stepped by Sync_Step()
+  if (Mode_Array_Pos == 12) {Parting();}                                // feeds are stepped by Sync_Step(), retracts by Planner_Run()
+  if (Mode_Array_Pos == 13) {Groove();            ZY_Steppers.run();}   // feeds are synchronized segments, stepped by Sync_Step()
+  if (Mode_Array_Pos == 14) {Polygon();}                                // both axes are stepped by Sync_Step(), the cross slide off the spindle angle
+  //if (Mode_Array_Pos == 15) {Knurling();          ZY_Steppers.run();}
+  //if (Mode_Array_Pos == 16) {Test_Menu();         ZY_Steppers.run();}
+
+  Protocol_Update();                                // host commands and telemetry over USB serial
+  Telemetry_Update();
 
 }
 
@@ -116,3 +142,21 @@ double ZY_Movement() {
 #include <string>
 #include "Auto_Radius.h"
 #include "Chamfer.h"
+#include "Settings.h"
+#include "Jobs.h"
+#include "Protocol.h"
+#include "Sync.h"
+#include "Step_Output.h"
+#include "Planner.h"
+#include "GCode.h"
+#include "Telemetry.h"
+#include "Follow.h"
+#include "Axis_Encoders.h"
+#include "Cycles.h"
+#include "Taper.h"
+#include "Ball.h"
+#include "Face.h"
+#include "Parting.h"
+#include "Groove.h"
+#include "Polygon.h"
+#include "Soft_Stop.h"
@@ -29,7 +29,13 @@ void Main_Menu() {              // Main Menu
         Feed_Display.print(Measure_Array[1]);
       }
     Feed_Adjust();
-  
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,110); Feed_Display.print("   Chip Break:");
+      if (Chip_Break == 0) {Feed_Display.print(" Off");}
+      else {
+        if (Chip_Break == 1) {Feed_Display.print(" Pause ");}
+        if (Chip_Break == 2) {Feed_Display.print(" Back ");}
+        Feed_Display.print(Chip_Break_Revs); Feed_Display.print("r");
+      }
   }
 
   //----Thread----//
@@ -63,39 +69,63 @@ void Main_Menu() {              // Main Menu
       if (Pitch_Array[Pitch_Array_Pos] > 9) {DECp = 1;}   // this allows us to shorten the decimal point of the array when displayed so that we dont wrap the decimal to the next line
       else {DECp = 2;}
       Feed_Display.setCursor(10,55); Feed_Display.print(Pitch_Array[Pitch_Array_Pos], DECp); }
+    if (Thread_Hand == 1) {Feed_Display.setTextSize(1); Feed_Display.setCursor(100,104); Feed_Display.print("LH");}
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,104); Feed_Display.print("Stop: ");
+      if (Thread_Mode == 0 && in_Thread_Stop > 0) {Feed_Display.print(in_Thread_Stop,3); Feed_Display.print(" in");}
+      else if (Thread_Mode == 1 && mm_Thread_Stop > 0) {Feed_Display.print(mm_Thread_Stop,2); Feed_Display.print(" mm");}
+      else {Feed_Display.print("Off");}
+    Follow_Display();
   }
 
   //----Auto Thread----//
   if (Mode_Array_Pos == 2) {
-    Feed_Display.setTextSize(2);
-    Feed_Display.setCursor(2,20);
-      if (Thread_Mode == 0) {
-        Feed_Display.fillRect(0,19,36,16,SSD1327_WHITE);       //fill selection with a contrasting rectangle
-        Feed_Display.setTextColor(SSD1327_BLACK);
-        Feed_Display.print("TPI ");
-        Feed_Display.setTextColor(SSD1327_WHITE);
-      } else {
-        Feed_Display.setTextColor(SSD1327_WHITE);
-        Feed_Display.print("TPI");
-      }
-      Feed_Display.print("/"); 
-      if (Thread_Mode == 1) {
-        Feed_Display.fillRect(59,19,64,16,SSD1327_WHITE);       //fill selection with a contrasting rectangle
-        Feed_Display.setTextColor(SSD1327_BLACK);
-        Feed_Display.print(" Pitch");
-        Feed_Display.setTextColor(SSD1327_WHITE);
+    if (Thread_Taper != 0) {                              // pipe thread, size from the table
+      Feed_Display.setTextSize(2);
+      Feed_Display.setCursor(2,20);
+      Feed_Display.print(Taper_Thread_Array[Thread_Taper]); Feed_Display.print(" "); Feed_Display.print(Pipe_TPI(),1);
+      Feed_Display.setTextSize(3);
+      Feed_Display.setCursor(10,45); Feed_Display.print(Pipe_Array[Pipe_Array_Pos]);
+    } else {
+      Feed_Display.setTextSize(2);
+      Feed_Display.setCursor(2,20);
+        if (Thread_Mode == 0) {
+          Feed_Display.fillRect(0,19,36,16,SSD1327_WHITE);       //fill selection with a contrasting rectangle
+          Feed_Display.setTextColor(SSD1327_BLACK);
+          Feed_Display.print("TPI ");
+          Feed_Display.setTextColor(SSD1327_WHITE);
+        } else {
+          Feed_Display.setTextColor(SSD1327_WHITE);
+          Feed_Display.print("TPI");
+        }
+        Feed_Display.print("/"); 
+        if (Thread_Mode == 1) {
+          Feed_Display.fillRect(59,19,64,16,SSD1327_WHITE);       //fill selection with a contrasting rectangle
+          Feed_Display.setTextColor(SSD1327_BLACK);
+          Feed_Display.print(" Pitch");
+          Feed_Display.setTextColor(SSD1327_WHITE);
         
-      } else {
-        Feed_Display.setTextColor(SSD1327_WHITE);
-        Feed_Display.print("Pitch");
-      }
-    Feed_Display.setTextSize(4);
-    if (Thread_Mode == 0) {Feed_Display.setCursor(35,45); Feed_Display.print(TPI_Array[TPI_Array_Pos]);}
-    else {
-      int DECp;
-      if (Pitch_Array[Pitch_Array_Pos] > 9) {DECp = 1;} // this allows us to shorten the decimal point of the array when displayed so that we dont wrap the decimal to the next line
-      else {DECp = 2;}
-      Feed_Display.setCursor(10,45); Feed_Display.print(Pitch_Array[Pitch_Array_Pos], DECp); }
+        } else {
+          Feed_Display.setTextColor(SSD1327_WHITE);
+          Feed_Display.print("Pitch");
+        }
+      Feed_Display.setTextSize(4);
+      if (Thread_Mode == 0) {Feed_Display.setCursor(35,45); Feed_Display.print(TPI_Array[TPI_Array_Pos]);}
+      else {
+        int DECp;
+        if (Pitch_Array[Pitch_Array_Pos] > 9) {DECp = 1;} // this allows us to shorten the decimal point of the array when displayed so that we dont wrap the decimal to the next line
+        else {DECp = 2;}
+        Feed_Display.setCursor(10,45); Feed_Display.print(Pitch_Array[Pitch_Array_Pos], DECp); }
+    }
+    if (Thread_Starts > 1) {                              // multi-start, the number above is the pitch
+      Feed_Display.setTextSize(1); Feed_Display.setCursor(2,36);
+      Feed_Display.print(Thread_Starts); Feed_Display.print(" starts  Lead ");
+      if (Thread_Taper == 1) {Feed_Display.print(Thread_Starts / Pipe_TPI(), 4);}
+      else if (Thread_Taper == 2) {Feed_Display.print(Thread_Starts * 25.4 / Pipe_TPI(), 2);}
+      else if (Thread_Mode == 0) {Feed_Display.print(Thread_Starts / TPI_Array[TPI_Array_Pos], 4);}
+      else {Feed_Display.print(Thread_Starts * Pitch_Array[Pitch_Array_Pos], 2);}
+    }
+    if (Thread_Hand == 1) {Feed_Display.setTextSize(1); Feed_Display.setCursor(110,55); Feed_Display.print("LH");}
+    if (Direction_Array_Pos == 1) {Feed_Display.setTextSize(1); Feed_Display.setCursor(110,65); Feed_Display.print(">T");}   // toward the tailstock
     Feed_Display.setTextSize(1); Feed_Display.setCursor(0,80); Feed_Display.print("    Cut Depth:");
       if (Thread_Mode == 0) {Feed_Display.print(" "); Feed_Display.print(in_DOC,3);}
       if (Thread_Mode == 1) {Feed_Display.print(" "); Feed_Display.print(mm_DOC,2);} 
@@ -190,17 +220,328 @@ void Main_Menu() {              // Main Menu
       if (Radius_type == 3) {Feed_Display.print(" "); Feed_Display.print("Right Concave");}
   }
 
+  //----G-Code----//
+  if (Mode_Array_Pos == 8) {
+    Feed_Display.setTextSize(1);
+    Feed_Display.setCursor(0,30);
+    Feed_Display.print("Lines: "); Feed_Display.println(GCode_Lines);
+    Feed_Display.setCursor(0,45);
+    Feed_Display.print("Queue: "); Feed_Display.print(Planner_Count()); Feed_Display.print("/"); Feed_Display.println(Planner_Size - 1);
+    Feed_Display.setCursor(0,60);
+    if (Planner_Hold == 1) {Feed_Display.println("Held");}
+    else {Feed_Display.println("Running");}
+    if (GCode_Error != 0) {
+      Feed_Display.setCursor(0,80);
+      Feed_Display.print("Error "); Feed_Display.print(GCode_Error); Feed_Display.print(" line "); Feed_Display.println(GCode_Error_Line);
+    }
+    Follow_Display();
+  }
+
+  //----Chamfer----//
+  if (Mode_Array_Pos == 7) {
+    Feed_Display.setTextSize(2);
+    Feed_Display.setCursor(19,20);
+      if (Metric == 0) {
+        Feed_Display.fillRect(18,19,Measure_Array[0].length() * 12 + 1,16,SSD1327_WHITE);       //fill selection with a contrasting rectangle
+        Feed_Display.setTextColor(SSD1327_BLACK);
+        Feed_Display.print("In ");
+        Feed_Display.setTextColor(SSD1327_WHITE);
+      } else {
+        Feed_Display.setTextColor(SSD1327_WHITE);
+        Feed_Display.print("In ");
+      }
+      Feed_Display.print("/");
+      if (Metric == 1) {
+        Feed_Display.fillRect(77,19,Measure_Array[1].length() * 12 + 2,16,SSD1327_WHITE);       //fill selection with a contrasting rectangle
+        Feed_Display.setTextColor(SSD1327_BLACK);
+        Feed_Display.print(" mm");
+        Feed_Display.setTextColor(SSD1327_WHITE);
+      } else {
+        Feed_Display.setTextColor(SSD1327_WHITE);
+        Feed_Display.print(" mm");
+      }
+    Auto_Feed_Adjust();
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,80); Feed_Display.print("Type:");
+      if (Chamfer_type == 0) {Feed_Display.print(" "); Feed_Display.print("OD Right");}
+      if (Chamfer_type == 1) {Feed_Display.print(" "); Feed_Display.print("OD Left");}
+      if (Chamfer_type == 2) {Feed_Display.print(" "); Feed_Display.print("ID Right");}
+      if (Chamfer_type == 3) {Feed_Display.print(" "); Feed_Display.print("ID Left");}
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,92); Feed_Display.print("         Size:");
+      if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Chamfer_Size,3);}
+      if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Chamfer_Size,2);}
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,104); Feed_Display.print("        Angle: "); Feed_Display.print(Chamfer_Angle,1);
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,116); Feed_Display.print("       D.O.C.:");
+      if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_DOC,3);}
+      if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_DOC,2);}
+  }
+
+  //----Taper----//
+  if (Mode_Array_Pos == 9) {
+    Feed_Display.setTextSize(2);
+    Feed_Display.setCursor(19,20);
+      if (Metric == 0) {
+        Feed_Display.fillRect(18,19,Measure_Array[0].length() * 12 + 1,16,SSD1327_WHITE);       //fill selection with a contrasting rectangle
+        Feed_Display.setTextColor(SSD1327_BLACK);
+        Feed_Display.print("In ");
+        Feed_Display.setTextColor(SSD1327_WHITE);
+      } else {
+        Feed_Display.setTextColor(SSD1327_WHITE);
+        Feed_Display.print("In ");
+      }
+      Feed_Display.print("/");
+      if (Metric == 1) {
+        Feed_Display.fillRect(77,19,Measure_Array[1].length() * 12 + 2,16,SSD1327_WHITE);       //fill selection with a contrasting rectangle
+        Feed_Display.setTextColor(SSD1327_BLACK);
+        Feed_Display.print(" mm");
+        Feed_Display.setTextColor(SSD1327_WHITE);
+      } else {
+        Feed_Display.setTextColor(SSD1327_WHITE);
+        Feed_Display.print(" mm");
+      }
+    Auto_Feed_Adjust();
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,80); Feed_Display.print("    Start Dia:");
+      if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Outside_Diameter,3);}
+      if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Outside_Diameter,2);}
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,92);
+      if (Taper_type == 0) {
+        Feed_Display.print("      End Dia:");
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Final_Diameter,3);}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Final_Diameter,2);}
+      } else {
+        Feed_Display.print("        Angle: "); Feed_Display.print(Taper_Angle,1);
+      }
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,104); Feed_Display.print("       Length:");
+      if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_length_of_cut,3);}
+      if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_length_of_cut,2);}
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,116); Feed_Display.print("       D.O.C.:");
+      if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_DOC,3);}
+      if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_DOC,2);}
+  }
+
+  //----Ball----//
+  if (Mode_Array_Pos == 10) {
+    Feed_Display.setTextSize(2);
+    Feed_Display.setCursor(19,20);
+      if (Metric == 0) {
+        Feed_Display.fillRect(18,19,Measure_Array[0].length() * 12 + 1,16,SSD1327_WHITE);       //fill selection with a contrasting rectangle
+        Feed_Display.setTextColor(SSD1327_BLACK);
+        Feed_Display.print("In ");
+        Feed_Display.setTextColor(SSD1327_WHITE);
+      } else {
+        Feed_Display.setTextColor(SSD1327_WHITE);
+        Feed_Display.print("In ");
+      }
+      Feed_Display.print("/");
+      if (Metric == 1) {
+        Feed_Display.fillRect(77,19,Measure_Array[1].length() * 12 + 2,16,SSD1327_WHITE);       //fill selection with a contrasting rectangle
+        Feed_Display.setTextColor(SSD1327_BLACK);
+        Feed_Display.print(" mm");
+        Feed_Display.setTextColor(SSD1327_WHITE);
+      } else {
+        Feed_Display.setTextColor(SSD1327_WHITE);
+        Feed_Display.print(" mm");
+      }
+    Auto_Feed_Adjust();
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,80); Feed_Display.print("    Stock Dia:");
+      if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Outside_Diameter,3);}
+      if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Outside_Diameter,2);}
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,92); Feed_Display.print("     Ball Dia:");
+      if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Ball_Diameter,3);}
+      if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Ball_Diameter,2);}
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,104);
+      if (Ball_type == 0) {
+        Feed_Display.print("   Hemisphere");
+      } else {
+        Feed_Display.print("     Neck Dia:");
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Ball_Neck,3);}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Ball_Neck,2);}
+      }
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,116); Feed_Display.print("       D.O.C.:");
+      if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_DOC,3);}
+      if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_DOC,2);}
+  }
+
+  //----Face----//
+  if (Mode_Array_Pos == 11) {
+    Feed_Display.setTextSize(2);
+    Feed_Display.setCursor(19,20);
+      if (Metric == 0) {
+        Feed_Display.fillRect(18,19,Measure_Array[0].length() * 12 + 1,16,SSD1327_WHITE);       //fill selection with a contrasting rectangle
+        Feed_Display.setTextColor(SSD1327_BLACK);
+        Feed_Display.print("In ");
+        Feed_Display.setTextColor(SSD1327_WHITE);
+      } else {
+        Feed_Display.setTextColor(SSD1327_WHITE);
+        Feed_Display.print("In ");
+      }
+      Feed_Display.print("/");
+      if (Metric == 1) {
+        Feed_Display.fillRect(77,19,Measure_Array[1].length() * 12 + 2,16,SSD1327_WHITE);       //fill selection with a contrasting rectangle
+        Feed_Display.setTextColor(SSD1327_BLACK);
+        Feed_Display.print(" mm");
+        Feed_Display.setTextColor(SSD1327_WHITE);
+      } else {
+        Feed_Display.setTextColor(SSD1327_WHITE);
+        Feed_Display.print(" mm");
+      }
+    if (Face_type == 0) {Auto_Feed_Adjust();}
+    else {
+      Feed_Display.setTextSize(4);
+      Feed_Display.setCursor(0,45);
+      if (Metric == 0) {Feed_Display.print(in_Face_Rate, 2);}
+      else {Feed_Display.print(mm_Face_Rate, 1);}
+    }
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,80); Feed_Display.print("         Feed:");
+      if (Face_type == 0) {Feed_Display.print(" Per Rev");}
+      if (Face_type == 1) {Feed_Display.print(" Per Min");}
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,92); Feed_Display.print("    Stock Dia:");
+      if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Outside_Diameter,3);}
+      if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Outside_Diameter,2);}
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,104); Feed_Display.print("        Depth:");
+      if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Face_Depth,3);}
+      if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Face_Depth,2);}
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,116); Feed_Display.print("       D.O.C.:");
+      if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_DOC,3);}
+      if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_DOC,2);}
+  }
+
+  //----Parting----//
+  if (Mode_Array_Pos == 12) {
+    Feed_Display.setTextSize(2);
+    Feed_Display.setCursor(19,20);
+      if (Metric == 0) {
+        Feed_Display.fillRect(18,19,Measure_Array[0].length() * 12 + 1,16,SSD1327_WHITE);       //fill selection with a contrasting rectangle
+        Feed_Display.setTextColor(SSD1327_BLACK);
+        Feed_Display.print("In ");
+        Feed_Display.setTextColor(SSD1327_WHITE);
+      } else {
+        Feed_Display.setTextColor(SSD1327_WHITE);
+        Feed_Display.print("In ");
+      }
+      Feed_Display.print("/");
+      if (Metric == 1) {
+        Feed_Display.fillRect(77,19,Measure_Array[1].length() * 12 + 2,16,SSD1327_WHITE);       //fill selection with a contrasting rectangle
+        Feed_Display.setTextColor(SSD1327_BLACK);
+        Feed_Display.print(" mm");
+        Feed_Display.setTextColor(SSD1327_WHITE);
+      } else {
+        Feed_Display.setTextColor(SSD1327_WHITE);
+        Feed_Display.print(" mm");
+      }
+    Auto_Feed_Adjust();
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,80); Feed_Display.print("    Stock Dia:");
+      if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Outside_Diameter,3);}
+      if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Outside_Diameter,2);}
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,92); Feed_Display.print("     Stop Dia:");
+      if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Part_Diameter,3);}
+      if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Part_Diameter,2);}
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,104); Feed_Display.print("   Peck Every:");
+      if (Part_Peck_Revs == 0) {Feed_Display.print(" Off");}
+      else {Feed_Display.print(" "); Feed_Display.print(Part_Peck_Revs); Feed_Display.print(" rev");}
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,116); Feed_Display.print("      Retract:");
+      if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Part_Retract,3);}
+      if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Part_Retract,2);}
+  }
+
+  //----Groove----//
+  if (Mode_Array_Pos == 13) {
+    Feed_Display.setTextSize(2);
+    Feed_Display.setCursor(19,20);
+      if (Metric == 0) {
+        Feed_Display.fillRect(18,19,Measure_Array[0].length() * 12 + 1,16,SSD1327_WHITE);       //fill selection with a contrasting rectangle
+        Feed_Display.setTextColor(SSD1327_BLACK);
+        Feed_Display.print("In ");
+        Feed_Display.setTextColor(SSD1327_WHITE);
+      } else {
+        Feed_Display.setTextColor(SSD1327_WHITE);
+        Feed_Display.print("In ");
+      }
+      Feed_Display.print("/");
+      if (Metric == 1) {
+        Feed_Display.fillRect(77,19,Measure_Array[1].length() * 12 + 2,16,SSD1327_WHITE);       //fill selection with a contrasting rectangle
+        Feed_Display.setTextColor(SSD1327_BLACK);
+        Feed_Display.print(" mm");
+        Feed_Display.setTextColor(SSD1327_WHITE);
+      } else {
+        Feed_Display.setTextColor(SSD1327_WHITE);
+        Feed_Display.print(" mm");
+      }
+    Auto_Feed_Adjust();
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,80); Feed_Display.print("     Position:");
+      if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Groove_Position,3);}
+      if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Groove_Position,2);}
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,92); Feed_Display.print("        Width:");
+      if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Groove_Width,3);}
+      if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Groove_Width,2);}
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,104); Feed_Display.print("        Depth:");
+      if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Groove_Depth,3);}
+      if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Groove_Depth,2);}
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,116); Feed_Display.print("   Tool Width:");
+      if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Groove_Tool,3);}
+      if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Groove_Tool,2);}
+  }
+
+  //----Polygon----//
+  if (Mode_Array_Pos == 14) {
+    Polygon_Build();
+    Feed_Display.setTextSize(2);
+    Feed_Display.setCursor(19,20);
+      if (Metric == 0) {
+        Feed_Display.fillRect(18,19,Measure_Array[0].length() * 12 + 1,16,SSD1327_WHITE);       //fill selection with a contrasting rectangle
+        Feed_Display.setTextColor(SSD1327_BLACK);
+        Feed_Display.print("In ");
+        Feed_Display.setTextColor(SSD1327_WHITE);
+      } else {
+        Feed_Display.setTextColor(SSD1327_WHITE);
+        Feed_Display.print("In ");
+      }
+      Feed_Display.print("/");
+      if (Metric == 1) {
+        Feed_Display.fillRect(77,19,Measure_Array[1].length() * 12 + 2,16,SSD1327_WHITE);       //fill selection with a contrasting rectangle
+        Feed_Display.setTextColor(SSD1327_BLACK);
+        Feed_Display.print(" mm");
+        Feed_Display.setTextColor(SSD1327_WHITE);
+      } else {
+        Feed_Display.setTextColor(SSD1327_WHITE);
+        Feed_Display.print(" mm");
+      }
+    Auto_Feed_Adjust();
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,80); Feed_Display.print("        Shape:");
+      if (Polygon_type == 0) {Feed_Display.print(" "); Feed_Display.print(Polygon_Sides); Feed_Display.print(" Sides");}
+      if (Polygon_type == 1) {Feed_Display.print(" Eccentric");}
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,92);
+      if (Polygon_type == 0) {Feed_Display.print(" Across Flats:");}
+      if (Polygon_type == 1) {Feed_Display.print("     Diameter:");}
+      if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Polygon_Size,3);}
+      if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Polygon_Size,2);}
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,104); Feed_Display.print("       Length:");
+      if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Polygon_Length,3);}
+      if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Polygon_Length,2);}
+    Feed_Display.setTextSize(1); Feed_Display.setCursor(0,116); Feed_Display.print("      Max RPM:");
+      if (Polygon_Table_Length == 0) {Feed_Display.print(" --");}
+      else {Feed_Display.print(" "); Feed_Display.print(Polygon_Max_RPM,0);}
+  }
+
   //----Place holder for unused modes----//
-  if (Mode_Array_Pos > 3 && Mode_Array_Pos != 6) {
+  if (Mode_Array_Pos > 3 && Mode_Array_Pos < 6) {
     Feed_Display.setCursor(0 + Mode_Array_Pos * 6, 30 + Mode_Array_Pos * 5);
     Feed_Display.println("Coming");
     Feed_Display.setCursor(0 + Mode_Array_Pos * 10, 60 + Mode_Array_Pos * 5);
     Feed_Display.print("Soon");
   }
   
+  Mode_0_SubMenu();
+  Mode_1_SubMenu();
   Mode_2_SubMenu();
   Mode_3_SubMenu();
   Mode_6_SubMenu();
+  Mode_7_SubMenu();
+  Mode_9_SubMenu();
+  Mode_10_SubMenu();
+  Mode_11_SubMenu();
+  Mode_12_SubMenu();
+  Mode_13_SubMenu();
+  Mode_14_SubMenu();
 }
 
 void Feed_Adjust(){             // Feed Adjust sub routine
@@ -230,6 +571,91 @@ void Auto_Feed_Clear(){              // Clear Feed Rate on Main Menu
   Feed_Display.fillRect(0,45,128,30,SSD1327_BLACK);
 }
 
+void Mode_0_SubMenu() {         // Feed Sub Menu, chip breaking and soft stops
+  if (Mode_Array_Pos == 0 && submenu >= 1) {
+    Feed_Display.clearDisplay();
+    Feed_Display.setTextColor(SSD1327_WHITE);
+    Feed_Display.setTextSize(2);
+    Feed_Display.setCursor(0,0);
+    if (submenu <= 3) {Feed_Display.println("Chip Break");}
+    else {Feed_Display.println("Soft Stop");}
+    if (submenu == 1) {                                   // submenu page one --- Off, pause or back off
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Type");
+      Feed_Display.setCursor(0,100);
+        if (Chip_Break == 0) {Feed_Display.println("  Off");}
+        if (Chip_Break == 1) {Feed_Display.println("  Pause");}
+        if (Chip_Break == 2) {Feed_Display.println(" Back Off");}
+    }
+    if (submenu == 2) {                                   // submenu page two --- Revs between breaks
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Break");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Every");
+      Feed_Display.setCursor(0,100);
+        Feed_Display.print(" "); Feed_Display.print(Chip_Break_Revs); Feed_Display.println(" rev");
+    }
+    if (submenu == 3) {                                   // submenu page three --- Spindle degrees per break
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Break");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  For");
+      Feed_Display.setCursor(0,100);
+        Feed_Display.print(" "); Feed_Display.print(Chip_Break_Degrees,0); Feed_Display.println(" deg");
+    }
+    if (submenu >= 4 && submenu <= 7) {                   // submenu pages four to seven --- Soft stops, shown as the distance to them
+      Feed_Display.setCursor(0,45);
+      if (submenu <= 5) {Feed_Display.println("   Z");} else {Feed_Display.println("   X");}
+      Feed_Display.setCursor(0,65);
+      if (submenu == 4 || submenu == 6) {Feed_Display.println("   Min");} else {Feed_Display.println("   Max");}
+      Feed_Display.setCursor(0,100);
+        if (submenu == 4) {Soft_Stop_Display(&Z_Soft, 0, LeadScrew);}
+        if (submenu == 5) {Soft_Stop_Display(&Z_Soft, 1, LeadScrew);}
+        if (submenu == 6) {Soft_Stop_Display(&X_Soft, 0, CrossSlide);}
+        if (submenu == 7) {Soft_Stop_Display(&X_Soft, 1, CrossSlide);}
+    }
+  }
+}
+
+void Mode_1_SubMenu() {         // Thread Sub Menu, thread stop, hand and pull out
+  if (Mode_Array_Pos == 1 && submenu >= 1) {
+    Feed_Display.clearDisplay();
+    Feed_Display.setTextColor(SSD1327_WHITE);
+    Feed_Display.setTextSize(2);
+    Feed_Display.setCursor(0,0);
+    Feed_Display.println("  Thread");
+    if (submenu == 1) {                                   // submenu page one --- Leadscrew stop
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Stop");
+      Feed_Display.setCursor(0,100);
+        if (Thread_Mode == 0 && in_Thread_Stop > 0) {Feed_Display.print(" "); Feed_Display.print(in_Thread_Stop,3); Feed_Display.println(" in");}
+        else if (Thread_Mode == 1 && mm_Thread_Stop > 0) {Feed_Display.print(" "); Feed_Display.print(mm_Thread_Stop,2); Feed_Display.println(" mm");}
+        else {Feed_Display.println("  Off");}
+    }
+    if (submenu == 2) {                                   // submenu page two --- Hand
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Hand");
+      Feed_Display.setCursor(0,100);
+        Feed_Display.print(" "); Feed_Display.println(Hand_Array[Thread_Hand]);
+    }
+    if (submenu == 3) {                                   // submenu page three --- Pull out at the stop
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println(" Pull Out");
+      Feed_Display.setCursor(0,100);
+        if (Thread_Pull_Angle > 0) {Feed_Display.print(" "); Feed_Display.print(Thread_Pull_Angle,0); Feed_Display.println(" deg");}
+        else {Feed_Display.println("  Off");}
+    }
+  }
+}
+
 void Mode_2_SubMenu() {         // Auto Thread Sub Menu
   // need DOC, Thread Diameter, Thread Length
   if (Mode_Array_Pos == 2 && submenu >= 1) {
@@ -242,7 +668,8 @@ void Mode_2_SubMenu() {         // Auto Thread Sub Menu
         Feed_Display.println("   Auto");
         Feed_Display.println("Threading");
       }
-    if (submenu == 1) {                                   // submenu page one --- Thread Length
+    if (submenu == 1) {Job_Page();}                      // submenu page one --- Job library
+    if (submenu == 2) {                                   // submenu page two --- Thread Length
       Feed_Display.setCursor(0,45);
       Feed_Display.println("  Input");
       Feed_Display.setCursor(0,65);
@@ -251,7 +678,7 @@ void Mode_2_SubMenu() {         // Auto Thread Sub Menu
         if (Thread_Mode == 0) {Feed_Display.print(" "); Feed_Display.print(in_length_of_cut,3); Feed_Display.println(" in");}
         if (Thread_Mode == 1) {Feed_Display.print(" "); Feed_Display.print(mm_length_of_cut,3); Feed_Display.println(" mm");} 
     }
-    if (submenu == 2) {                                   // submenu page two --- Thread Diameter
+    if (submenu == 3) {                                   // submenu page three --- Thread Diameter
       Feed_Display.setCursor(0,45);
       Feed_Display.println("  Input");
       Feed_Display.setCursor(0,65);
@@ -260,7 +687,7 @@ void Mode_2_SubMenu() {         // Auto Thread Sub Menu
       if (Thread_Mode == 0) {Feed_Display.print(" "); Feed_Display.print(in_Outside_Diameter,3); Feed_Display.println(" in");}
       if (Thread_Mode == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Outside_Diameter,2); Feed_Display.println(" mm");}
     }
-    if (submenu == 3) {                                   // submenu page three --- Depth of cut
+    if (submenu == 4) {                                   // submenu page four --- Depth of cut
       Feed_Display.setCursor(0,45);
       Feed_Display.println("  Input");
       Feed_Display.setCursor(0,65);
@@ -269,29 +696,101 @@ void Mode_2_SubMenu() {         // Auto Thread Sub Menu
         if (Thread_Mode == 0) {Feed_Display.print(" "); Feed_Display.print(in_DOC,3); Feed_Display.println(" in");}
         if (Thread_Mode == 1) {Feed_Display.print(" "); Feed_Display.print(mm_DOC,2); Feed_Display.println(" mm");} 
     }
-  }
-}
-
-void Mode_3_SubMenu() {         // Auto Thread Sub Menu
-  if (Mode_Array_Pos == 3 && submenu >= 1) {
-    if (submenu >= 1 && Mode_Array_Pos == 3) {
-      Feed_Display.clearDisplay();
-      Feed_Display.setTextColor(SSD1327_WHITE);
-      Feed_Display.setTextSize(2); 
-      Feed_Display.setCursor(0,0);
-      Feed_Display.println("Auto Turn");
-      Feed_Display.println("    OD   ");              // this could be a selection in the future for OD or ID
-    }
-    if (submenu == 1) {                                   // submenu page one --- Thread Length
+    if (submenu == 5) {                                   // submenu page five --- Starts
       Feed_Display.setCursor(0,45);
       Feed_Display.println("  Input");
       Feed_Display.setCursor(0,65);
-      Feed_Display.println("Cut Length");
+      Feed_Display.println("  Starts");
       Feed_Display.setCursor(0,100);
-        if (Thread_Mode == 0) {Feed_Display.print(" "); Feed_Display.print(in_length_of_cut,3); Feed_Display.println(" in");}
+        Feed_Display.print("    "); Feed_Display.println(Thread_Starts);
+      Feed_Display.setTextSize(1);
+      Feed_Display.setCursor(0,118);
+      Feed_Display.print(" Lead = pitch x "); Feed_Display.print(Thread_Starts);
+    }
+    if (submenu == 6) {                                   // submenu page six --- Straight or pipe thread
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Taper");
+      Feed_Display.setCursor(0,100);
+        Feed_Display.print(" "); Feed_Display.println(Taper_Thread_Array[Thread_Taper]);
+    }
+    if (submenu == 7) {                                   // submenu page seven --- Pipe size
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println(" Pipe Size");
+      Feed_Display.setCursor(0,100);
+        if (Thread_Taper == 0) {Feed_Display.println("  N/A");}
+        else {Feed_Display.print(Pipe_Array[Pipe_Array_Pos]); Feed_Display.print(" "); Feed_Display.println(Pipe_TPI(),1);}
+    }
+    if (submenu == 8) {                                   // submenu page eight --- Hand
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Hand");
+      Feed_Display.setCursor(0,100);
+        Feed_Display.print(" "); Feed_Display.println(Hand_Array[Thread_Hand]);
+    }
+    if (submenu == 9) {                                   // submenu page nine --- Cut toward the headstock or the tailstock
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println(" Direction");
+      Feed_Display.setCursor(0,100);
+        Feed_Display.print(" "); Feed_Display.println(Direction_Array[Direction_Array_Pos]);
+    }
+    if (submenu == 10) {                                  // submenu page ten --- Pull out at the end of the thread
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println(" Pull Out");
+      Feed_Display.setCursor(0,100);
+        if (Thread_Pull_Angle > 0) {Feed_Display.print(" "); Feed_Display.print(Thread_Pull_Angle,0); Feed_Display.println(" deg");}
+        else {Feed_Display.println("  Off");}
+    }
+    if (submenu == 11) {                                  // submenu page eleven --- Start Cut
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("Click Right");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println(" Encoder to");
+      Feed_Display.setCursor(0,85);
+      Feed_Display.println(" Start/Stop");
+      Feed_Display.setTextSize(1);
+      Feed_Display.setCursor(0,105);
+      if (status == 1) {Feed_Display.print(" Running");}
+      else {
+        Feed_Display.print(" Lead ");
+        if (Thread_Mode == 0) {Feed_Display.print(Thread_Lead_In / (Steps_Per_Thou * 1000), 3);}
+        else {Feed_Display.print(Thread_Lead_In / (Steps_Per_hundredth_mm * 100), 2);}
+        Feed_Display.print(" Max "); Feed_Display.print(Thread_Max_RPM, 0);
+      }
+      Follow_Display();
+    }
+  }
+}
+
+void Mode_3_SubMenu() {         // Auto Thread Sub Menu
+  if (Mode_Array_Pos == 3 && submenu >= 1) {
+    if (submenu >= 1 && Mode_Array_Pos == 3) {
+      Feed_Display.clearDisplay();
+      Feed_Display.setTextColor(SSD1327_WHITE);
+      Feed_Display.setTextSize(2); 
+      Feed_Display.setCursor(0,0);
+      Feed_Display.println("Auto Turn");
+      Feed_Display.println("    OD   ");              // this could be a selection in the future for OD or ID
+    }
+    if (submenu == 1) {Job_Page();}                      // submenu page one --- Job library
+    if (submenu == 2) {                                   // submenu page two --- Thread Length
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("Cut Length");
+      Feed_Display.setCursor(0,100);
+        if (Thread_Mode == 0) {Feed_Display.print(" "); Feed_Display.print(in_length_of_cut,3); Feed_Display.println(" in");}
         if (Thread_Mode == 1) {Feed_Display.print(" "); Feed_Display.print(mm_length_of_cut,3); Feed_Display.println(" mm");} 
     }
-    if (submenu == 2) {                                   // submenu page two --- Thread Diameter
+    if (submenu == 3) {                                   // submenu page three --- Thread Diameter
       Feed_Display.setCursor(0,45);
       Feed_Display.println("  Input");
       Feed_Display.setCursor(0,65);
@@ -300,7 +799,7 @@ void Mode_3_SubMenu() {         // Auto Thread Sub Menu
       if (Thread_Mode == 0) {Feed_Display.print(" "); Feed_Display.print(in_Outside_Diameter,3); Feed_Display.println(" in");}
       if (Thread_Mode == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Outside_Diameter,2); Feed_Display.println(" mm");}
     }
-    if (submenu == 3) {                                   // submenu page three --- Final Diameter
+    if (submenu == 4) {                                   // submenu page four --- Final Diameter
       Feed_Display.setCursor(0,45);
       Feed_Display.println("  Input");
       Feed_Display.setCursor(0,65);
@@ -309,7 +808,7 @@ void Mode_3_SubMenu() {         // Auto Thread Sub Menu
         if (Thread_Mode == 0) {Feed_Display.print(" "); Feed_Display.print(in_Final_Diameter,3); Feed_Display.println(" in");}
         if (Thread_Mode == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Final_Diameter,2); Feed_Display.println(" mm");} 
     }
-    if (submenu == 4) {                                   // submenu page four --- Depth of cut
+    if (submenu == 5) {                                   // submenu page five --- Depth of cut
       Feed_Display.setCursor(0,45);
       Feed_Display.println("  Input");
       Feed_Display.setCursor(0,65);
@@ -331,7 +830,8 @@ void Mode_6_SubMenu() {         // Auto Thread Sub Menu
       Feed_Display.println("  Auto");
       Feed_Display.println("  Radius");              // this could be a selection in the future for OD or ID
     }
-    if (submenu == 1) {                                   // submenu page one  --- Radius type
+    if (submenu == 1) {Job_Page();}                      // submenu page one --- Job library
+    if (submenu == 2) {                                   // submenu page two  --- Radius type
       Feed_Display.setCursor(0,45);
       Feed_Display.println("  Input");
       Feed_Display.setCursor(0,65);
@@ -342,7 +842,7 @@ void Mode_6_SubMenu() {         // Auto Thread Sub Menu
         if (Radius_type == 2) {Feed_Display.println("  Left"); Feed_Display.println("  Concave");}
         if (Radius_type == 3) {Feed_Display.println("  Right"); Feed_Display.println("  Concave");}
     }
-    if (submenu == 2) {                                   // submenu page one  --- Radius
+    if (submenu == 3) {                                   // submenu page three  --- Radius
       Feed_Display.setCursor(0,45);
       Feed_Display.println("  Input");
       Feed_Display.setCursor(0,65);
@@ -351,7 +851,7 @@ void Mode_6_SubMenu() {         // Auto Thread Sub Menu
         if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Radius,3); Feed_Display.println(" in");}
         if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Radius,3); Feed_Display.println(" mm");} 
     }
-    if (submenu == 3) {                                   // submenu page two  --- Total Steps
+    if (submenu == 4) {                                   // submenu page four  --- Total Steps
       Feed_Display.setCursor(0,45);
       Feed_Display.println("  Input");
       Feed_Display.setCursor(0,65);
@@ -359,7 +859,7 @@ void Mode_6_SubMenu() {         // Auto Thread Sub Menu
       Feed_Display.setCursor(0,100);
         Feed_Display.print(" "); Feed_Display.print(Radius_Steps,DEC); Feed_Display.println(" Steps");
     }
-    if (submenu == 4) {                                   // submenu page four --- Depth of cut
+    if (submenu == 5) {                                   // submenu page five --- Depth of cut
       Feed_Display.setCursor(0,45);
       Feed_Display.println("  Input");
       Feed_Display.println("  DOC");
@@ -369,7 +869,7 @@ void Mode_6_SubMenu() {         // Auto Thread Sub Menu
         Feed_Display.setTextSize(1); Feed_Display.setCursor(0,115); Feed_Display.print("Total Cut Passes "); Feed_Display.println(Cut_Passes);
       
     }
-    if (submenu == 5) {                                   // submenu page four --- Start Cut
+    if (submenu == 6) {                                   // submenu page six --- Start Cut
       Feed_Display.setCursor(0,45);
       Feed_Display.println("Click Right");
       Feed_Display.setCursor(0,65);
@@ -382,6 +882,482 @@ void Mode_6_SubMenu() {         // Auto Thread Sub Menu
   }
 }
 
+void Mode_7_SubMenu() {         // Chamfer Sub Menu
+  if (Mode_Array_Pos == 7 && submenu >= 1) {
+    Feed_Display.clearDisplay();
+    Feed_Display.setTextColor(SSD1327_WHITE);
+    Feed_Display.setTextSize(2);
+    Feed_Display.setCursor(0,0);
+    Feed_Display.println(" Chamfer");
+    if (submenu == 1) {                                   // submenu page one --- Chamfer type
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Type");
+      Feed_Display.setCursor(0,90);
+        if (Chamfer_type == 0) {Feed_Display.println("  OD"); Feed_Display.println("  Right");}
+        if (Chamfer_type == 1) {Feed_Display.println("  OD"); Feed_Display.println("  Left");}
+        if (Chamfer_type == 2) {Feed_Display.println("  ID"); Feed_Display.println("  Right");}
+        if (Chamfer_type == 3) {Feed_Display.println("  ID"); Feed_Display.println("  Left");}
+    }
+    if (submenu == 2) {                                   // submenu page two --- Chamfer size
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Size");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Chamfer_Size,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Chamfer_Size,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 3) {                                   // submenu page three --- Chamfer angle
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Angle");
+      Feed_Display.setCursor(0,100);
+        Feed_Display.print(" "); Feed_Display.print(Chamfer_Angle,1); Feed_Display.println(" deg");
+    }
+    if (submenu == 4) {                                   // submenu page four --- Depth of cut
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  D.O.C.");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_DOC,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_DOC,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 5) {                                   // submenu page five --- Finish pass
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Finish");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(final_pass_in,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(final_pass_mm,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 6) {                                   // submenu page six --- Start Cut
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("Click Right");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println(" Encoder to");
+      Feed_Display.setCursor(0,85);
+      Feed_Display.println(" Start/Stop");
+      Cycle_Update();
+    }
+  }
+}
+
+void Mode_9_SubMenu() {         // Taper Sub Menu
+  if (Mode_Array_Pos == 9 && submenu >= 1) {
+    Feed_Display.clearDisplay();
+    Feed_Display.setTextColor(SSD1327_WHITE);
+    Feed_Display.setTextSize(2);
+    Feed_Display.setCursor(0,0);
+    Feed_Display.println("  Taper");
+    if (submenu == 1) {                                   // submenu page one --- Taper type
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Type");
+      Feed_Display.setCursor(0,90);
+        if (Taper_type == 0) {Feed_Display.println(" Start/End"); Feed_Display.println(" Diameter");}
+        if (Taper_type == 1) {Feed_Display.println(" Start Dia"); Feed_Display.println(" and Angle");}
+    }
+    if (submenu == 2) {                                   // submenu page two --- Start diameter
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("Start Dia");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Outside_Diameter,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Outside_Diameter,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 3) {                                   // submenu page three --- End diameter or angle
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      if (Taper_type == 0) {Feed_Display.println(" End Dia");}
+      else {Feed_Display.println("  Angle");}
+      Feed_Display.setCursor(0,100);
+        if (Taper_type == 0 && Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Final_Diameter,3); Feed_Display.println(" in");}
+        if (Taper_type == 0 && Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Final_Diameter,2); Feed_Display.println(" mm");}
+        if (Taper_type == 1) {Feed_Display.print(" "); Feed_Display.print(Taper_Angle,1); Feed_Display.println(" deg");}
+    }
+    if (submenu == 4) {                                   // submenu page four --- Taper length
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Length");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_length_of_cut,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_length_of_cut,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 5) {                                   // submenu page five --- Depth of cut
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  D.O.C.");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_DOC,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_DOC,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 6) {                                   // submenu page six --- Finish pass
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Finish");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(final_pass_in,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(final_pass_mm,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 7) {                                   // submenu page seven --- Start Cut
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("Click Right");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println(" Encoder to");
+      Feed_Display.setCursor(0,85);
+      Feed_Display.println(" Start/Stop");
+      Cycle_Update();
+    }
+  }
+}
+
+void Mode_10_SubMenu() {        // Ball Sub Menu
+  if (Mode_Array_Pos == 10 && submenu >= 1) {
+    Feed_Display.clearDisplay();
+    Feed_Display.setTextColor(SSD1327_WHITE);
+    Feed_Display.setTextSize(2);
+    Feed_Display.setCursor(0,0);
+    Feed_Display.println("   Ball");
+    if (submenu == 1) {                                   // submenu page one --- Ball type
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Type");
+      Feed_Display.setCursor(0,90);
+        if (Ball_type == 0) {Feed_Display.println(" Hemi-"); Feed_Display.println(" sphere");}
+        if (Ball_type == 1) {Feed_Display.println(" Full"); Feed_Display.println(" Sphere");}
+    }
+    if (submenu == 2) {                                   // submenu page two --- Stock diameter
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("Stock Dia");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Outside_Diameter,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Outside_Diameter,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 3) {                                   // submenu page three --- Ball diameter
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("Ball Dia");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Ball_Diameter,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Ball_Diameter,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 4) {                                   // submenu page four --- Neck diameter
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("Neck Dia");
+      Feed_Display.setCursor(0,100);
+        if (Ball_type == 0) {Feed_Display.println(" Full Only");}
+        if (Ball_type == 1 && Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Ball_Neck,3); Feed_Display.println(" in");}
+        if (Ball_type == 1 && Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Ball_Neck,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 5) {                                   // submenu page five --- Depth of cut
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  D.O.C.");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_DOC,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_DOC,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 6) {                                   // submenu page six --- Finish pass
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Finish");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(final_pass_in,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(final_pass_mm,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 7) {                                   // submenu page seven --- Start Cut
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("Click Right");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println(" Encoder to");
+      Feed_Display.setCursor(0,85);
+      Feed_Display.println(" Start/Stop");
+      Cycle_Update();
+    }
+  }
+}
+
+void Mode_11_SubMenu() {        // Face Sub Menu
+  if (Mode_Array_Pos == 11 && submenu >= 1) {
+    Feed_Display.clearDisplay();
+    Feed_Display.setTextColor(SSD1327_WHITE);
+    Feed_Display.setTextSize(2);
+    Feed_Display.setCursor(0,0);
+    Feed_Display.println("   Face");
+    if (submenu == 1) {                                   // submenu page one --- Feed type
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Feed");
+      Feed_Display.setCursor(0,90);
+        if (Face_type == 0) {Feed_Display.println(" Per Rev");}
+        if (Face_type == 1) {Feed_Display.println(" Per Min");}
+    }
+    if (submenu == 2) {                                   // submenu page two --- Stock diameter
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("Stock Dia");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Outside_Diameter,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Outside_Diameter,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 3) {                                   // submenu page three --- Stock off the face
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Depth");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Face_Depth,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Face_Depth,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 4) {                                   // submenu page four --- Depth of cut
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  D.O.C.");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_DOC,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_DOC,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 5) {                                   // submenu page five --- Finish pass
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Finish");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(final_pass_in,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(final_pass_mm,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 6) {                                   // submenu page six --- Start Cut
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("Click Right");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println(" Encoder to");
+      Feed_Display.setCursor(0,85);
+      Feed_Display.println(" Start/Stop");
+      Cycle_Update();
+    }
+  }
+}
+
+void Mode_12_SubMenu() {        // Parting Sub Menu
+  if (Mode_Array_Pos == 12 && submenu >= 1) {
+    Feed_Display.clearDisplay();
+    Feed_Display.setTextColor(SSD1327_WHITE);
+    Feed_Display.setTextSize(2);
+    Feed_Display.setCursor(0,0);
+    Feed_Display.println("  Part");
+    if (submenu == 1) {                                   // submenu page one --- Stock diameter
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("Stock Dia");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Outside_Diameter,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Outside_Diameter,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 2) {                                   // submenu page two --- Stop diameter
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("Stop Dia");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Part_Diameter,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Part_Diameter,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 3) {                                   // submenu page three --- Revs between pecks
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Peck");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Every");
+      Feed_Display.setCursor(0,100);
+        if (Part_Peck_Revs == 0) {Feed_Display.println("  Off");}
+        else {Feed_Display.print(" "); Feed_Display.print(Part_Peck_Revs); Feed_Display.println(" rev");}
+    }
+    if (submenu == 4) {                                   // submenu page four --- Peck retract
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println(" Retract");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Part_Retract,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Part_Retract,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 5) {                                   // submenu page five --- Start Cut
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("Click Right");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println(" Encoder to");
+      Feed_Display.setCursor(0,85);
+      Feed_Display.println(" Start/Stop");
+      Cycle_Update();
+    }
+  }
+}
+
+void Mode_13_SubMenu() {        // Groove Sub Menu
+  if (Mode_Array_Pos == 13 && submenu >= 1) {
+    Feed_Display.clearDisplay();
+    Feed_Display.setTextColor(SSD1327_WHITE);
+    Feed_Display.setTextSize(2);
+    Feed_Display.setCursor(0,0);
+    Feed_Display.println("  Groove");
+    if (submenu == 1) {                                   // submenu page one --- End face to the groove
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println(" Position");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Groove_Position,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Groove_Position,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 2) {                                   // submenu page two --- Groove width
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Width");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Groove_Width,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Groove_Width,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 3) {                                   // submenu page three --- Groove depth
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Depth");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Groove_Depth,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Groove_Depth,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 4) {                                   // submenu page four --- Tool width
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("Tool Width");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Groove_Tool,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Groove_Tool,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 5) {                                   // submenu page five --- Dwell at the bottom
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Dwell");
+      Feed_Display.setCursor(0,100);
+        Feed_Display.print(" "); Feed_Display.print(Groove_Dwell,1); Feed_Display.println(" rev");
+    }
+    if (submenu == 6) {                                   // submenu page six --- Finish pass
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Finish");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(final_pass_in,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(final_pass_mm,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 7) {                                   // submenu page seven --- Start Cut
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("Click Right");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println(" Encoder to");
+      Feed_Display.setCursor(0,85);
+      Feed_Display.println(" Start/Stop");
+      Cycle_Update();
+    }
+  }
+}
+
+void Mode_14_SubMenu() {        // Polygon Sub Menu
+  if (Mode_Array_Pos == 14 && submenu >= 1) {
+    Polygon_Build();
+    Feed_Display.clearDisplay();
+    Feed_Display.setTextColor(SSD1327_WHITE);
+    Feed_Display.setTextSize(2);
+    Feed_Display.setCursor(0,0);
+    Feed_Display.println(" Polygon");
+    if (submenu == 1) {                                   // submenu page one --- Polygon or eccentric
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Shape");
+      Feed_Display.setCursor(0,90);
+        if (Polygon_type == 0) {Feed_Display.println(" Polygon");}
+        if (Polygon_type == 1) {Feed_Display.println(" Eccentric");}
+    }
+    if (submenu == 2) {                                   // submenu page two --- Number of sides
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println("  Sides");
+      Feed_Display.setCursor(0,100);
+        if (Polygon_type == 1) {Feed_Display.println(" Poly Only");}
+        else {Feed_Display.print(" "); Feed_Display.println(Polygon_Sides);}
+    }
+    if (submenu == 3) {                                   // submenu page three --- Across flats or eccentric diameter
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println(" Size");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Polygon_Size,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Polygon_Size,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 4) {                                   // submenu page four --- Eccentric offset
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println(" Offset");
+      Feed_Display.setCursor(0,100);
+        if (Polygon_type == 0) {Feed_Display.println(" Ecc Only");}
+        if (! (Polygon_type == 0) && Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Polygon_Offset,3); Feed_Display.println(" in");}
+        if (! (Polygon_type == 0) && Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Polygon_Offset,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 5) {                                   // submenu page five --- Length
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("  Input");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println(" Length");
+      Feed_Display.setCursor(0,100);
+        if (Metric == 0) {Feed_Display.print(" "); Feed_Display.print(in_Polygon_Length,3); Feed_Display.println(" in");}
+        if (Metric == 1) {Feed_Display.print(" "); Feed_Display.print(mm_Polygon_Length,2); Feed_Display.println(" mm");}
+    }
+    if (submenu == 6) {                                   // submenu page six --- Start Cut
+      Feed_Display.setCursor(0,45);
+      Feed_Display.println("Click Right");
+      Feed_Display.setCursor(0,65);
+      Feed_Display.println(" Encoder to");
+      Feed_Display.setCursor(0,85);
+      Feed_Display.println(" Start/Stop");
+      Feed_Display.setTextSize(1);
+      Feed_Display.setCursor(0,105);
+      if (status == 1) {Feed_Display.print(" Running");}
+      else if (Polygon_Table_Length == 0) {Feed_Display.print(" Check the shape");}
+      else {Feed_Display.print(" Max RPM "); Feed_Display.print(Polygon_Max_RPM,0);}
+      Follow_Display();
+    }
+  }
+}
+
 void Radius_Update(){
   Feed_Display.setCursor(0,100);
       Feed_Display.println(" Current Pos");
@@ -391,3 +1367,13 @@ void Radius_Update(){
       else if (status == 3) {Feed_Display.println(" Finishing");}
       else if (status == 4) {Feed_Display.println(" Complete");}
 }
+
+/** @brief Peak following error of the last cut, and HOLD after a trip, for the modes that lock to the spindle */
+void Follow_Display() {
+  Feed_Display.setTextSize(1);
+  Feed_Display.setCursor(0,116);
+  Feed_Display.print("Peak err: ");
+  if (Metric == 0) {Feed_Display.print(Follow_Peak / (Steps_Per_Thou * 1000), 4);}
+  else {Feed_Display.print(Follow_Peak / (Steps_Per_hundredth_mm * 100), 3);}
+  if (Follow_Hold == 1) {Feed_Display.print(" HOLD");}
+}
@@ -0,0 +1,52 @@
+/*
+  Parting off, ran as a canned cycle (Cycles.h).
+
+  Touch the tool off on the stock diameter at the parting position.  The cross slide feeds in per spindle rev
+  until the work is down to in_Part_Diameter, 0 parts it right off.  With Part_Peck_Revs set, the feed is split
+  into pecks of that many revs: the feed is locked to the spindle encoder count, so each peck ends after exactly
+  that many revs of the spindle.  After each peck the tool backs out by the retract distance to clear the chip and
+  comes back to one rev of feed short of where it stopped.  The retracts ramp up and down at the axis
+  acceleration rather than jumping to full speed, so the mode steps them from Planner_Run() and never runs ZY_Steppers.
+*/
+void Parting() {
+  if (status == 0) {Part_Plan(); Cycle_Begin(Part_Pass);}
+  Cycle_Run();
+}
+
+/** @brief Works the parting cut out in steps from the inputs, ran when the cycle starts */
+void Part_Plan() {
+  double Stock, Stop, Retract, Feed;
+  if (Metric == 0) {Stock = in_Outside_Diameter; Stop = in_Part_Diameter; Retract = in_Part_Retract; Feed = In_FeedRate;}
+  else {Stock = mm_Outside_Diameter; Stop = mm_Part_Diameter; Retract = mm_Part_Retract; Feed = mm_FeedRate;}
+  Part_Depth = Cycle_Steps((Stock - Stop) / 2);
+  Part_Retract = Cycle_Steps(Retract);
+  Part_Gap = Cycle_Steps(Feed);
+  if (Part_Gap > Part_Retract) {Part_Gap = Part_Retract;}
+  Part_Peck = Part_Depth;
+  if (Part_Peck_Revs > 0) {Part_Peck = Cycle_Steps(Feed * Part_Peck_Revs);}
+  if (Part_Peck < 1) {Part_Peck = 1;}
+  Part_Pecks = (Part_Depth + Part_Peck - 1) / Part_Peck;
+  if (Part_Depth <= 0) {Part_Pecks = -1;}                             // nothing to cut
+}
+
+/**
+  @brief Queues one peck of the parting cycle, then the retract back to the start
+  @param Pass  : peck number from 0
+*/
+int Part_Pass(int Pass) {
+  if (Part_Pecks < 0) {return 0;}
+  if (Pass > Part_Pecks) {return 0;}
+  if (Pass == Part_Pecks) {Cycle_Retract(0, 0); return 1;}
+  double Feed = (Metric == 0) ? In_FeedRate : mm_FeedRate;
+  long Bottom = -(long)Pass * Part_Peck;                              // where the last peck stopped
+  long X = Bottom - Part_Peck;
+  if (X < -Part_Depth) {X = -Part_Depth;}
+
+  if (Pass == 0) {Cycle_Retract(0, Cycle_Steps((Metric == 0) ? in_Cycle_Clear : mm_Cycle_Clear));}
+  else {
+    Cycle_Retract(0, Bottom + Part_Retract);                          // peck out to clear the chip
+    Cycle_Retract(0, Bottom + Part_Gap);
+  }
+  Cycle_Feed(0, X, Feed, 1);
+  return 1;
+}
@@ -0,0 +1,107 @@
+/** @brief Segments waiting in the motion queue */
+int Planner_Count() {
+  return (Planner_Tail - Planner_Head + Planner_Size) % Planner_Size;
+}
+
+/** @brief Places left in the motion queue, one place is always kept empty to tell full from empty */
+int Planner_Free() {
+  return Planner_Size - 1 - Planner_Count();
+}
+
+/** @brief Adds a segment to the end of the queue, returns false if the queue is full
+    @param Segment  : move to add
+*/
+bool Planner_Push(const Motion_Segment *Segment) {
+  if (Planner_Free() == 0) {return false;}
+  Planner_Queue[Planner_Tail] = *Segment;
+  Planner_Tail = (Planner_Tail + 1) % Planner_Size;
+  return true;
+}
+
+/** @brief Throws away every queued segment and stops the one running where it is */
+void Planner_Clear() {
+  Planner_Head = Planner_Tail;
+  if (Planner_Busy == 1) {
+    if (Planner_Current.Type == Seg_Sync) {Sync_Stop();}
+    else {
+      LeadScrew.setCurrentPosition(LeadScrew.currentPosition());        // drops the target so ZY_Steppers stops here
+      CrossSlide.setCurrentPosition(CrossSlide.currentPosition());
+      LeadScrew.setMaxSpeed(LeadSpeed);
+      CrossSlide.setMaxSpeed(Cross_Speed);
+    }
+    Planner_Busy = 0;
+  }
+}
+
+/**
+  @brief Runs the motion queue, called every loop() pass in G-Code mode.  Waits for the running segment to
+         finish and then starts the next one, never blocks
+*/
+void Planner_Run() {
+  if (Planner_Busy == 1) {
+    if (Planner_Current.Type == Seg_Sync) {
+      if (Sync_Active == 1) {return;}
+      LeadScrew.setCurrentPosition(Sync_Z_Pos);                           // hand the steppers back to AccelStepper
+      CrossSlide.setCurrentPosition(Sync_X_Pos);
+    } else if (Planner_Current.Type == Seg_Dwell) {
+      cli();
+      int32_t Count = spindle.read();
+      sei();
+      if (labs(Count - Planner_Dwell_Start) < Planner_Current.Num) {return;}
+    } else {
+      if (Planner_Current.Type == Seg_Accel) {LeadScrew.run(); CrossSlide.run();}
+      if (LeadScrew.distanceToGo() != 0 || CrossSlide.distanceToGo() != 0) {return;}
+      LeadScrew.setMaxSpeed(LeadSpeed);
+      CrossSlide.setMaxSpeed(Cross_Speed);
+    }
+    Planner_Busy = 0;
+  }
+  if (Planner_Hold == 1 || Follow_Tripped == 1 || Planner_Count() == 0) {return;}
+
+  Planner_Current = Planner_Queue[Planner_Head];
+  Planner_Head = (Planner_Head + 1) % Planner_Size;
+  Planner_Start(&Planner_Current);
+  Planner_Busy = 1;
+}
+
+/** @brief Sets the steppers off on one segment
+    @param Segment  : move to start
+*/
+void Planner_Start(const Motion_Segment *Segment) {
+  if (Segment->Type == Seg_Sync) {
+    int Dir = (Segment->Z < LeadScrew.currentPosition()) ? -1 : 1;
+    Sync_Start(Segment->Z, Segment->X, Segment->Num, Segment->Den, Segment->Phase, 0, Segment->Angle, Segment->Ramp);
+    if (Segment->Pull_Run > 0) {
+      cli();
+      Sync_Pull(Segment->Z - Dir * Segment->Pull_Run, Dir, Segment->Pull_Run, Segment->Pull_Rise);
+      sei();
+    }
+    return;
+  }
+
+  if (Segment->Type == Seg_Dwell) {                                    // the axes stay put while the spindle turns
+    cli();
+    Planner_Dwell_Start = spindle.read();
+    sei();
+    return;
+  }
+  long Target[2] = {Segment->Z, Segment->X};
+  Soft_Stop_Line(Target, Target);                                      // synchronized moves are held off the stops in Sync_Step()
+  long Z = Target[0];
+  long X = Target[1];
+  if (Segment->Type == Seg_Accel) {                                    // AccelStepper ramps each axis up and down on its own
+    LeadScrew.moveTo(Z);
+    CrossSlide.moveTo(X);
+    return;
+  }
+
+  long DZ = labs(Z - LeadScrew.currentPosition());
+  long DX = labs(X - CrossSlide.currentPosition());
+  if (Segment->Type == Seg_Feed && Segment->Rate > 0) {
+    // ZY_Steppers times the move on the slowest axis, so capping each axis at its share of the feed gives the feed along the path
+    double Time = sqrt((double)DZ * DZ + (double)DX * DX) / Segment->Rate;
+    if (DZ > 0) {LeadScrew.setMaxSpeed(fmin(LeadSpeed, DZ / Time));}
+    if (DX > 0) {CrossSlide.setMaxSpeed(fmin(Cross_Speed, DX / Time));}
+  }
+  ZY_Steppers.moveTo(Target);
+}
@@ -0,0 +1,50 @@
+/*
+  Polygon and eccentric turning.
+
+  The cross slide position is a function of the spindle angle: Polygon_Build() works the shape out once into
+  Polygon_Table, cross slide steps out from the start for every spindle count of one rev, and the synchronized
+  step generator looks it up by the encoder count every tick (Sync_Profile in Sync.h) while the leadscrew feeds
+  toward the headstock per spindle rev.  Table entry 0 is spindle angle zero, the middle of a flat or the low
+  side of the eccentric, so every pass lands on the same shape.
+
+  Start with the tool at the radius of the flats (or the low side) clear of the end of the work.  The cross slide
+  has to keep up with the steepest part of the table, Polygon_Max_RPM is the fastest spindle it can do that at.  Any
+  faster and it falls behind the shape and rounds the corners off, the following error monitor only holds the feed
+  once it is a full in_Follow_Limit behind.
+*/
+void Polygon() {
+  if (status != 1 && Sync_Profile_On == 1) {Sync_Stop();}               // stopped from the start page
+  if (status == 0) {Polygon_Start();}
+  if (status == 1 && Sync_Active == 0) {Sync_Stop(); status = -1;}      // fed its length
+}
+
+/** @brief Works the shape out into Polygon_Table for the current SpindleCPR, left alone while the table is in use */
+void Polygon_Build() {
+  if (Sync_Profile_On == 1) {return;}
+  long CPR = lround(SpindleCPR);
+  Polygon_Table_Length = 0;
+  Polygon_Max_RPM = 0;
+  if (CPR < 1 || CPR > Polygon_Table_Max) {return;}
+  double R, E;
+  if (Metric == 0) {R = Steps_per_Move(in_Polygon_Size / 2); E = Steps_per_Move(in_Polygon_Offset);}
+  else {R = Steps_per_Move(mm_Polygon_Size / 2); E = Steps_per_Move(mm_Polygon_Offset);}
+  if (Polygon_Profile(Polygon_type, Polygon_Sides, R, E, CPR, Polygon_Table) == 0) {return;}   // Polygon_Profile.h
+  Polygon_Table_Length = CPR;
+  Polygon_Max_RPM = Polygon_Profile_Max_RPM(Polygon_Table, CPR, Cross_Speed);
+}
+
+/** @brief Builds the table and starts the cut from where the tool is, ran when the start page button is pressed */
+void Polygon_Start() {
+  Polygon_Build();
+  double Length = (Metric == 0) ? in_Polygon_Length : mm_Polygon_Length;
+  if (Polygon_Table_Length == 0 || Length <= 0) {status = -1; return;}  // nothing to cut
+  long long Num, Den;
+  if (Metric == 0) {Sync_Ratio(In_FeedRate, 0, &Num, &Den);}
+  else {Sync_Ratio(mm_FeedRate, 1, &Num, &Den);}
+  Follow_Peak = 0;
+  Sync_Profile = Polygon_Table;
+  Sync_Profile_Length = Polygon_Table_Length;
+  Sync_Profile_On = 1;
+  Sync_Start(LeadScrew.currentPosition() - Cycle_Steps(Length), CrossSlide.currentPosition(), Num, Den, 1);   // from angle zero
+  status = 1;
+}
@@ -0,0 +1,169 @@
+/**
+  @brief Services the USB serial protocol, ran once per loop().  Only Protocol_Rx_Budget bytes are decoded per pass
+         and nothing here waits on the serial port, so a chatty host can never hold up the steppers
+*/
+void Protocol_Update() {
+  int Budget = Protocol_Rx_Budget;
+  while (Budget > 0 && Serial.available() > 0) {
+    int Length = Protocol_Decode_Byte(&Protocol_Rx, Serial.read());
+    if (Length > 0) {Protocol_Dispatch(Protocol_Rx.Frame, Length);}
+    Budget--;
+  }
+
+  if ((Protocol_Streams & Stream_Status) && millis() - Protocol_Status_Time >= Protocol_Status_Period) {
+    Protocol_Status_Time = millis();
+    Protocol_Send_Status();
+  }
+}
+
+/** @brief Acts on one good frame from the host
+    @param Frame   : decoded frame, type and seq first
+    @param Length  : frame length without the CRC
+*/
+void Protocol_Dispatch(const uint8_t *Frame, int Length) {
+  uint8_t Type = Frame[0];
+  uint8_t Seq = Frame[1];
+  const uint8_t *Payload = Frame + 2;
+  int Size = Length - 2;
+
+  if (Type == Msg_Ping) {Protocol_Ack(Type, Seq); return;}
+
+  if (Type == Msg_Get_Setting) {
+    if (Size != 1) {Protocol_Nak(Type, Seq, Nak_Length); return;}
+    if (Payload[0] >= Setting_Count) {Protocol_Nak(Type, Seq, Nak_Setting); return;}
+    Protocol_Send_Setting(Payload[0], Seq);
+    return;
+  }
+
+  if (Type == Msg_Set_Setting) {
+    if (Size != 5) {Protocol_Nak(Type, Seq, Nak_Length); return;}
+    uint8_t ID = Payload[0];
+    double Value = Protocol_Get_Float(Payload + 1);
+    if (ID >= Setting_Count || !(Value >= Protocol_Settings[ID].Min && Value <= Protocol_Settings[ID].Max)) {Protocol_Nak(Type, Seq, Nak_Setting); return;}   // NaN fails both
+    if (SpindleRPM != 0 && ID != Setting_In_FeedRate && ID != Setting_mm_FeedRate) {Protocol_Nak(Type, Seq, Nak_Busy); return;}   // same rule as the knobs, only feed changes on the fly
+    if (Protocol_Settings[ID].Real != NULL) {*Protocol_Settings[ID].Real = Value;}
+    else {*Protocol_Settings[ID].Whole = (int)Value;}
+    Protocol_Setting_Changed(ID);
+    Protocol_Send_Setting(ID, Seq);
+    return;
+  }
+
+  if (Type == Msg_Start_Cycle) {
+    if (Size != 0) {Protocol_Nak(Type, Seq, Nak_Length); return;}
+    if (Mode_Array_Pos == 6 && status == -1) {status = 0; Protocol_Ack(Type, Seq);}   // auto radius, same as the start button
+    else if (Mode_Array_Pos == 8) {Planner_Hold = 0; Protocol_Ack(Type, Seq);}       // run the queued G-code
+    else if (Cycle_Mode() && status == -1) {status = 0; Protocol_Ack(Type, Seq);}     // canned cycle
+    else {Protocol_Nak(Type, Seq, Nak_State);}
+    return;
+  }
+
+  if (Type == Msg_Stop_Cycle) {
+    if (Size != 0) {Protocol_Nak(Type, Seq, Nak_Length); return;}
+    if (Mode_Array_Pos <= 1) {Protocol_Nak(Type, Seq, Nak_State); return;}          // Feed and Thread mode's lock is taken again every pass, only the spindle stops it
+    status = -1; LeadScrew.stop(); CrossSlide.stop();                               // stop at current position, same as start_or_stop()
+    if (Mode_Array_Pos == 8) {Planner_Hold = 1; Planner_Clear(); GCode_Reset();}     // G-code program is thrown away, the next one starts here
+    if (Cycle_Mode()) {Cycle_Stop();}
+    Protocol_Ack(Type, Seq);
+    return;
+  }
+
+  if (Type == Msg_Subscribe) {
+    if (Size != 3) {Protocol_Nak(Type, Seq, Nak_Length); return;}
+    if ((Payload[0] & Stream_Motion) && (Protocol_Streams & Stream_Motion) == 0) {Telemetry_Reset();}    // first block holds fresh samples
+    Protocol_Streams = Payload[0];
+    Protocol_Status_Period = Protocol_Get_U16(Payload + 1);
+    if (Protocol_Status_Period < 10) {Protocol_Status_Period = 10;}
+    Protocol_Ack(Type, Seq);
+    return;
+  }
+
+  if (Type == Msg_GCode) {
+    if (Size == 0) {Protocol_Nak(Type, Seq, Nak_Length); return;}
+    if (GCode_Receive(Payload, Size) == 0) {Protocol_Nak(Type, Seq, Nak_Busy); return;}   // host resends the same chunk later
+    Protocol_Send_GCode_Ack(Seq);
+    return;
+  }
+
+  Protocol_Nak(Type, Seq, Nak_Unknown);
+}
+
+/** @brief Keeps the values that are derived from a setting in step after the host writes it
+    @param ID  : setting id that was written
+*/
+void Protocol_Setting_Changed(uint8_t ID) {
+  if (ID == Setting_Metric) {Measure_Array_Pos = Metric;}
+  if (ID == Setting_TPI_Array_Pos) {TPI = TPI_Array[TPI_Array_Pos];}
+  if (ID == Setting_Pitch_Array_Pos) {Pitch = Pitch_Array[Pitch_Array_Pos];}
+  if (ID == Setting_Thread_Taper || ID == Setting_Pipe_Array_Pos) {Pipe_Select();}
+  if (ID == Setting_Mode_Array_Pos) {Mode = Mode_Array_Pos; submenu = 0; Enc1.setEncoderPosition(Mode_Array_Pos);}
+  if (ID == Setting_Radius_type || ID == Setting_in_Radius || ID == Setting_mm_Radius || ID == Setting_Radius_Steps) {Build_ZY = 0;}
+  if (ID == Setting_Lead_Backlash || ID == Setting_Cross_Backlash || ID == Setting_Backlash_Rate) {Output_Configure();}
+}
+
+/** @brief Encodes and sends one frame, dropped if the USB buffer can not take all of it right now
+    @param Type     : message type
+    @param Seq      : sequence number
+    @param Payload  : message payload
+    @param Size     : payload length
+*/
+void Protocol_Send(uint8_t Type, uint8_t Seq, const uint8_t *Payload, int Size) {
+  uint8_t Encoded[Protocol_Max_Encoded];
+  int Length = Protocol_Encode(Type, Seq, Payload, Size, Encoded);
+  if (Length == 0 || Serial.availableForWrite() < Length) {return;}
+  Serial.write(Encoded, Length);
+}
+
+void Protocol_Ack(uint8_t Type, uint8_t Seq) {
+  Protocol_Send(Msg_Ack, Seq, &Type, 1);
+}
+
+void Protocol_Nak(uint8_t Type, uint8_t Seq, uint8_t Reason) {
+  uint8_t Payload[2] = {Type, Reason};
+  Protocol_Send(Msg_Nak, Seq, Payload, 2);
+}
+
+/** @brief Sends the current value of one setting
+    @param ID   : setting id
+    @param Seq  : sequence number of the request being answered
+*/
+void Protocol_Send_Setting(uint8_t ID, uint8_t Seq) {
+  uint8_t Payload[5];
+  double Value;
+  if (Protocol_Settings[ID].Real != NULL) {Value = *Protocol_Settings[ID].Real;}
+  else {Value = *Protocol_Settings[ID].Whole;}
+  Payload[0] = ID;
+  Protocol_Put_Float(Payload + 1, Value);
+  Protocol_Send(Msg_Setting, Seq, Payload, 5);
+}
+
+/**
+  @brief Sends one Stream_Status sample:
+         [millis u32][SpindleRPM float][LeadScrew steps i32][CrossSlide steps i32][Mode_Array_Pos u8][status i8]
+         [peak following error steps i32][feed hold u8][leadscrew slips u16][cross slide slips u16]
+*/
+void Protocol_Send_Status() {
+  uint8_t Payload[27];
+  Protocol_Put_U32(Payload, millis());
+  Protocol_Put_Float(Payload + 4, SpindleRPM);
+  Protocol_Put_U32(Payload + 8, LeadScrew.currentPosition());
+  Protocol_Put_U32(Payload + 12, CrossSlide.currentPosition());
+  Payload[16] = Mode_Array_Pos;
+  Payload[17] = status;
+  Protocol_Put_U32(Payload + 18, Follow_Peak);
+  Payload[22] = Follow_Hold;
+  Protocol_Put_U16(Payload + 23, Lead_Slips);
+  Protocol_Put_U16(Payload + 25, Cross_Slips);
+  Protocol_Send(Msg_Status, Protocol_Tx_Seq++, Payload, 27);
+}
+
+/** @brief Acknowledges a G-code chunk with the room left for more, the host keeps no more than that in flight
+    @param Seq  : sequence number of the chunk
+*/
+void Protocol_Send_GCode_Ack(uint8_t Seq) {
+  uint8_t Payload[11];
+  Protocol_Put_U16(Payload, GCode_Text_Free());
+  Protocol_Put_U32(Payload + 2, GCode_Lines);
+  Payload[6] = GCode_Error;
+  Protocol_Put_U32(Payload + 7, GCode_Error_Line);
+  Protocol_Send(Msg_GCode_Ack, Seq, Payload, 11);
+}
@@ -0,0 +1,120 @@
+/**
+  @brief Restores the saved settings at power up, called from setup() before anything uses them
+*/
+void Settings_Restore() {
+  Settings_Payload Stored;
+  if (Settings_Load(&Stored)) {Settings_Unpack(&Stored);}
+  Settings_Pack(&Settings_Saved);                       // what is in the store now, edits are compared against this
+}
+
+/**
+  @brief True while nothing can be stepping: no AccelStepper or synchronized move, no planner segment running and
+         nothing left in either output stage.  Writing the flash holds off interrupts, and Step_Tick() with them
+*/
+int Settings_Axes_Idle() {
+  if (LeadScrew.distanceToGo() != 0 || CrossSlide.distanceToGo() != 0) {return 0;}
+  if (Sync_Active == 1 || Planner_Busy == 1 || (Planner_Hold == 0 && Planner_Count() > 0)) {return 0;}
+  cli();
+  int Idle = Lead_Out.Queue == 0 && Lead_Out.Backlash_Left == 0 && Lead_Out.Comp_Owed == 0 &&
+             Cross_Out.Queue == 0 && Cross_Out.Backlash_Left == 0 && Cross_Out.Comp_Owed == 0;
+  sei();
+  return Idle;
+}
+
+/**
+  @brief Saves the settings once they have stopped changing for Settings_Settle_MS.  Polled from Refresh() while the
+         spindle is stopped and only written with the axes idle, so a flash write never lands in the middle of a
+         cut, a jog or a rapid
+*/
+void Settings_Update() {
+  Settings_Payload Current;
+  Settings_Pack(&Current);
+  if (memcmp(&Current, &Settings_Saved, sizeof(Settings_Payload)) == 0) {   // nothing new since the last save
+    Settings_Changed = 0;
+    return;
+  }
+  if (Settings_Changed == 0 || memcmp(&Current, &Settings_Pending, sizeof(Settings_Payload)) != 0) {   // still being edited, restart the timer
+    Settings_Pending = Current;
+    Settings_Changed = 1;
+    Settings_Changed_Time = millis();
+    return;
+  }
+  if (millis() - Settings_Changed_Time >= Settings_Settle_MS && Settings_Axes_Idle()) {
+    Settings_Save(&Current);
+    Settings_Saved = Current;
+    Settings_Changed = 0;
+  }
+}
+
+/** @brief Copies the current settings into a settings record
+    @param Data  : record to fill
+*/
+void Settings_Pack(Settings_Payload *Data) {
+  memset(Data, 0, sizeof(Settings_Payload));
+  Data->In_FeedRate = In_FeedRate;
+  Data->mm_FeedRate = mm_FeedRate;
+  Data->in_Radius = in_Radius;
+  Data->mm_Radius = mm_Radius;
+  Data->in_DOC = in_DOC;
+  Data->mm_DOC = mm_DOC;
+  Data->in_Outside_Diameter = in_Outside_Diameter;
+  Data->mm_Outside_Diameter = mm_Outside_Diameter;
+  Data->in_Final_Diameter = in_Final_Diameter;
+  Data->mm_Final_Diameter = mm_Final_Diameter;
+  Data->in_length_of_cut = in_length_of_cut;
+  Data->mm_length_of_cut = mm_length_of_cut;
+  Data->TPI_Array_Pos = TPI_Array_Pos;
+  Data->Pitch_Array_Pos = Pitch_Array_Pos;
+  Data->Mode_Array_Pos = Mode_Array_Pos;
+  Data->Metric = Metric;
+  Data->Thread_Mode = Thread_Mode;
+  Data->Radius_type = Radius_type;
+  Data->Radius_Steps = Radius_Steps;
+  Data->Thread_Starts = Thread_Starts;
+  Data->Thread_Taper = Thread_Taper;
+  Data->Pipe_Array_Pos = Pipe_Array_Pos;
+  Data->Thread_Hand = Thread_Hand;
+  Data->Direction_Array_Pos = Direction_Array_Pos;
+  Data->Thread_Pull_Angle = Thread_Pull_Angle;
+}
+
+/** @brief Takes a stored real setting if it is inside the range the host protocol allows it, otherwise the setting
+           keeps its value.  Compared as floats, the record holds them as float32
+    @param Setting  : setting to load
+    @param Value    : value from the record
+    @param ID       : Protocol_Setting_ID of the setting, for its range
+*/
+void Settings_Real(double *Setting, float Value, int ID) {
+  if (Value >= (float)Protocol_Settings[ID].Min && Value <= (float)Protocol_Settings[ID].Max) {*Setting = Value;}   // false for NaN too
+}
+
+/** @brief Loads a settings record into the current settings, anything out of range keeps its default
+    @param Data  : record to load
+*/
+void Settings_Unpack(const Settings_Payload *Data) {
+  Settings_Real(&In_FeedRate, Data->In_FeedRate, Setting_In_FeedRate);
+  Settings_Real(&mm_FeedRate, Data->mm_FeedRate, Setting_mm_FeedRate);
+  Settings_Real(&in_Radius, Data->in_Radius, Setting_in_Radius);
+  Settings_Real(&mm_Radius, Data->mm_Radius, Setting_mm_Radius);
+  Settings_Real(&in_DOC, Data->in_DOC, Setting_in_DOC);
+  Settings_Real(&mm_DOC, Data->mm_DOC, Setting_mm_DOC);
+  Settings_Real(&in_Outside_Diameter, Data->in_Outside_Diameter, Setting_in_Outside_Diameter);
+  Settings_Real(&mm_Outside_Diameter, Data->mm_Outside_Diameter, Setting_mm_Outside_Diameter);
+  Settings_Real(&in_Final_Diameter, Data->in_Final_Diameter, Setting_in_Final_Diameter);
+  Settings_Real(&mm_Final_Diameter, Data->mm_Final_Diameter, Setting_mm_Final_Diameter);
+  Settings_Real(&in_length_of_cut, Data->in_length_of_cut, Setting_in_length_of_cut);
+  Settings_Real(&mm_length_of_cut, Data->mm_length_of_cut, Setting_mm_length_of_cut);
+  if (Data->TPI_Array_Pos < TPI_Array_Size) {TPI_Array_Pos = Data->TPI_Array_Pos;}
+  if (Data->Pitch_Array_Pos < Pitch_Array_Size) {Pitch_Array_Pos = Data->Pitch_Array_Pos;}
+  if (Data->Mode_Array_Pos < Mode_Array_Size) {Mode_Array_Pos = Data->Mode_Array_Pos;}
+  if (Data->Metric <= 1) {Metric = Data->Metric; Measure_Array_Pos = Data->Metric;}
+  if (Data->Thread_Mode <= 1) {Thread_Mode = Data->Thread_Mode;}
+  if (Data->Radius_type <= 3) {Radius_type = Data->Radius_type;}
+  if (Data->Radius_Steps >= 1 && Data->Radius_Steps <= Radius_Max_steps) {Radius_Steps = Data->Radius_Steps;}
+  if (Data->Thread_Starts >= 1 && Data->Thread_Starts <= Thread_Starts_Max) {Thread_Starts = Data->Thread_Starts;}
+  if (Data->Thread_Taper < Taper_Thread_Array_Size) {Thread_Taper = Data->Thread_Taper;}
+  if (Data->Pipe_Array_Pos < Pipe_Array_Size) {Pipe_Array_Pos = Data->Pipe_Array_Pos;}
+  if (Data->Thread_Hand < Hand_Array_Size) {Thread_Hand = Data->Thread_Hand;}
+  if (Data->Direction_Array_Pos < Direction_Array_Size) {Direction_Array_Pos = Data->Direction_Array_Pos;}
+  Settings_Real(&Thread_Pull_Angle, Data->Thread_Pull_Angle, Setting_Thread_Pull_Angle);
+}
@@ -0,0 +1,201 @@
+/*
+  Soft stops.
+
+  Each axis can have a stop at either end of its travel (Z_Soft and X_Soft), set from the Feed submenu.  They are
+  enforced in Sync_Step(), every tick, on the targets of every synchronized move: Feed and Thread mode's lock, the
+  feeds and thread passes of the canned cycles, G-code feeds and polygon cuts.  However long a loop() pass takes,
+  an axis can't be stepped past one.
+
+  A plain clamp would stop the axis dead from full feed.  Within Span of a stop the target is bent onto a parabola
+  that comes into the stop with no speed left Span past it, so the axis slows at the rapid acceleration and comes
+  to rest exactly on the stop while the spindle carries on.  The bend only depends on the target, so backing the
+  spindle up runs the axis back out along the same curve, still locked to the spindle angle, and the following
+  error stays at the usual step or two.  Soft_Stop_Plan() works Span out every loop() pass from the spindle speed
+  and the ratio of the move running.  Sync_Step() only takes a new span up while the target is clear of both stops,
+  so a change in speed never makes the target jump.
+
+  Only a move that could take the axis past a stop is bent: one that ends at or short of it runs to its end point
+  exactly, as if the stop was not there.  With both stops of an axis in reach and closer together than two spans,
+  each gets half the gap to slow down in.
+
+  Moves that AccelStepper runs don't go through Sync_Step(), so Soft_Stop_Move() shortens them along their line
+  to end where they first reach a stop, for the G-code planner and Auto Radius.
+
+  The stops are kept in the same logical steps as the axis.  Anything that redefines a position rather than moving
+  to it (Set_Radius_Start_Postion()) shifts them by the same amount with Soft_Stop_Shift(), so they stay on the
+  same place on the machine.
+*/
+
+/**
+  @brief Bends an axis target onto its slow down into the stops, ran every tick by Sync_Step()
+  @param Stop    : stops of the axis
+  @param Target  : where the move wants the axis, logical steps
+  @param Low     : lowest target the move running can give the axis
+  @param High    : highest target the move running can give the axis
+  @return where the axis is allowed to be
+*/
+long Soft_Stop_Shape(Soft_Stop *Stop, long Target, long Low, long High) {
+  int Max_On = Stop->Max_On == 1 && High > Stop->Max;         // a move that ends on or short of a stop never slows for it
+  int Min_On = Stop->Min_On == 1 && Low < Stop->Min;
+  long Half = (Stop->Max - Stop->Min) / 2;                    // room each stop gets when both are in reach
+  if (Half < 0) {Half = 0;}
+  long Span = Stop->Span;
+  if (Max_On && Min_On && Span > Half) {Span = Half;}
+  int Near_Max = Max_On && Target > Stop->Max - Span;
+  int Near_Min = Min_On && Target < Stop->Min + Span;
+  if (Near_Max == 0 && Near_Min == 0) {
+    long Plan = Stop->Span_Plan;
+    if (Max_On && Min_On && Plan > Half) {Plan = Half;}
+    if ((Max_On == 0 || Target <= Stop->Max - Plan) && (Min_On == 0 || Target >= Stop->Min + Plan)) {Stop->Span = Stop->Span_Plan;}
+    return Target;
+  }
+  if (Span < 1) {return Near_Max ? Stop->Max : Stop->Min;}    // stops on top of each other, no room to slow down
+  long Past = Near_Max ? Target - (Stop->Max - Span) : (Stop->Min + Span) - Target;
+  long Short = 0;                                             // how far short of the stop the axis is
+  if (Past < 2 * Span) {Short = Span - Past + (long)((long long)Past * Past / (4LL * Span));}
+  return Near_Max ? Stop->Max - Short : Stop->Min + Short;
+}
+
+/**
+  @brief Fits the span of an axis in between where a synchronized move starts and the stops, so an axis starting
+         inside the slow down does not jump back out to the curve, ran by Sync_Start()
+  @param Stop  : stops of the axis
+  @param From  : where the axis is, logical steps
+*/
+void Soft_Stop_Begin(Soft_Stop *Stop, long From) {
+  long Room = Stop->Span;
+  if (Stop->Max_On == 1 && Stop->Max - From < Room) {Room = Stop->Max - From;}
+  if (Stop->Min_On == 1 && From - Stop->Min < Room) {Room = From - Stop->Min;}
+  Stop->Span = (Room < 1) ? 1 : Room;
+}
+
+/**
+  @brief Cuts the fraction of a straight move that can be made down to where this axis reaches one of its stops
+  @param Stop  : stops of the axis
+  @param From  : where the axis is, logical steps
+  @param To    : where the move takes it
+  @param Num   : fraction of the move, Num / Den, only ever made smaller
+  @param Den
+*/
+void Soft_Stop_Limit(const Soft_Stop *Stop, long From, long To, long long *Num, long long *Den) {
+  long Room;
+  if (Stop->Max_On == 1 && To > Stop->Max && To > From) {Room = Stop->Max - From;}
+  else if (Stop->Min_On == 1 && To < Stop->Min && To < From) {Room = From - Stop->Min;}
+  else {return;}                                              // ends on or short of the stops
+  if (Room < 0) {Room = 0;}                                   // already past the stop, go no further
+  long long Travel = labs(To - From);
+  if ((long long)Room * *Den < *Num * Travel) {*Num = Room; *Den = Travel;}
+}
+
+/**
+  @brief Shortens a straight move from where the axes are along its line, so it ends where it first reaches a stop
+  @param Target  : Z and X end points in logical steps
+  @param End     : where the move can go
+*/
+void Soft_Stop_Line(const long Target[2], long End[2]) {
+  long Z = LeadScrew.currentPosition();
+  long X = CrossSlide.currentPosition();
+  long long Num = 1, Den = 1;
+  Soft_Stop_Limit(&Z_Soft, Z, Target[0], &Num, &Den);
+  Soft_Stop_Limit(&X_Soft, X, Target[1], &Num, &Den);
+  End[0] = Z + (long)((Target[0] - Z) * Num / Den);           // rounded toward the start, never past a stop
+  End[1] = X + (long)((Target[1] - X) * Num / Den);
+}
+
+/**
+  @brief Starts a ZY_Steppers move held inside the stops, see Soft_Stop_Line()
+  @param Target  : Z and X end points in logical steps
+*/
+void Soft_Stop_Move(const long Target[2]) {
+  long End[2];
+  Soft_Stop_Line(Target, End);
+  ZY_Steppers.moveTo(End);
+}
+
+/**
+  @brief Moves the stops of an axis along with a redefined position, so they stay put on the machine
+  @param Stop   : stops of the axis
+  @param Shift  : new position minus old position, logical steps
+*/
+void Soft_Stop_Shift(Soft_Stop *Stop, long Shift) {
+  cli();
+  Stop->Min += Shift;
+  Stop->Max += Shift;
+  sei();
+}
+
+/**
+  @brief Steps an axis takes to stop from a speed
+  @param Rate   : steps/sec
+  @param Accel  : steps/sec/sec
+*/
+long Soft_Stop_Span(double Rate, double Accel) {
+  long Span = ceil(Rate * Rate / (2 * Accel));
+  return (Span < 1) ? 1 : Span;
+}
+
+/** @brief Works out how far ahead of the stops each axis has to start slowing for the move running, ran every loop() pass */
+void Soft_Stop_Plan() {
+  cli();
+  int Active = Sync_Active;
+  long long Num = Sync_Num;
+  long long Den = Sync_Den;
+  long Length = Sync_Length;
+  long Minor_Length = Sync_Minor_Length;
+  int Major_Is_X = Sync_Major_Is_X;
+  int Angle_Driven = Sync_Profile_On == 1 || Sync_Pull_On == 1;
+  sei();
+
+  double Major = 0;
+  if (Active == 1 && Den != 0) {Major = fabs(SpindleRPM) * Soft_Stop_Margin * SpindleCPR / 60 * llabs(Num) / Den;}
+  double Minor = (Length > 0) ? Major * Minor_Length / Length : 0;
+  double Z_Rate = Major_Is_X ? Minor : Major;
+  double X_Rate = Major_Is_X ? Major : Minor;
+  if (Angle_Driven) {X_Rate = Cross_Speed;}                   // X off the spindle angle can be anything up to its top speed
+  Z_Soft.Span_Plan = Soft_Stop_Span(fmin(Z_Rate, LeadSpeed), LeadSpeed / Rapid_Ramp_Time);
+  X_Soft.Span_Plan = Soft_Stop_Span(fmin(X_Rate, Cross_Speed), Cross_Speed / Rapid_Ramp_Time);
+}
+
+/**
+  @brief Sets or moves a stop from the submenu: the Enc2 button sets it where the axis is or turns it off, Enc2
+         moves it a step at a time
+  @param Stop   : stops of the axis
+  @param Max    : 1 = the stop at the top of the travel, 0 = the one at the bottom
+  @param Axis   : the axis, for where it is now
+*/
+void Soft_Stop_Controls(Soft_Stop *Stop, int Max, AccelStepper &Axis) {
+  int On = Max ? Stop->Max_On : Stop->Min_On;
+  long At = Max ? Stop->Max : Stop->Min;
+  if (Enc2_Button_Edge() == 1) {
+    if (On == 1) {On = 0;}
+    else {On = 1; At = Axis.currentPosition();}
+  }
+  if (On == 1) {
+    long Step = lround(Steps_per_Move((Metric == 0) ? .001 : .01));
+    if (Enc2.getEncoderPosition() < -1) {Step *= 10;}                         // Fast Scroll
+    if (Enc2.getEncoderPosition() < 0) {At += Step;}
+    if (Enc2.getEncoderPosition() > 1) {Step *= 10;}
+    if (Enc2.getEncoderPosition() > 0) {At -= Step;}
+  }
+  Enc2.setEncoderPosition(0);
+  cli();
+  if (Max) {Stop->Max = At; Stop->Max_On = On;}
+  else {Stop->Min = At; Stop->Min_On = On;}
+  sei();
+}
+
+/**
+  @brief Shows a stop on its submenu page as the distance from the axis to it
+  @param Stop   : stops of the axis
+  @param Max    : 1 = the stop at the top of the travel, 0 = the one at the bottom
+  @param Axis   : the axis, for where it is now
+*/
+void Soft_Stop_Display(const Soft_Stop *Stop, int Max, AccelStepper &Axis) {
+  int On = Max ? Stop->Max_On : Stop->Min_On;
+  long At = Max ? Stop->Max : Stop->Min;
+  if (On == 0) {Feed_Display.println("  Off"); return;}
+  long Steps = At - Axis.currentPosition();
+  Feed_Display.print(" ");
+  if (Metric == 0) {Feed_Display.print(Steps / (Steps_Per_Thou * 1000), 3); Feed_Display.println(" in");}
+  else {Feed_Display.print(Steps / (Steps_Per_hundredth_mm * 100), 2); Feed_Display.println(" mm");}
+}
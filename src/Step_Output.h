@@ -0,0 +1,142 @@
+/*
+  Step output stage.
+
+  Nothing else touches the step and direction pins.  LeadScrew and CrossSlide (ELS_Stepper) and the
+  synchronized step generator add their steps to Lead_Out.Queue / Cross_Out.Queue, Step_Tick() sends them
+  out, one tick high and at least one tick low, with a direction change written a tick ahead of the edge.
+
+  Backlash: when an axis reverses, Backlash steps are owed in the new direction.  They are sent on ticks the
+  axis has no step of its own to send, no faster than Backlash_Rate, so a coordinated move never waits on them
+  and its step timing is the same with or without compensation.  Take-up steps are kept in Extra and never
+  reach the position model, the motor is at logical position + Extra.  A reversal part way through a take-up
+  only owes back what was already taken up.
+
+  Pitch error: every logical step moves Position and walks the interpolation along the axis table with an
+  integer remainder, the same way Sync_Advance() walks a line, so there is no lookup or divide per step.  Each
+  whole step the correction changes by is owed to the motor.  A correction with the travel goes out on a spare
+  tick like a take-up step, one against the travel swallows the next step of the move, so the motor never
+  reverses for it.  Both end up in Extra.
+*/
+
+/** @brief Copies the backlash settings into the output stages, call after any of them change */
+void Output_Configure() {
+  cli();
+  Lead_Out.Backlash = Lead_Backlash;
+  Cross_Out.Backlash = Cross_Backlash;
+  Lead_Out.Takeup_Rate = Backlash_Rate * Step_Tick_US;
+  Cross_Out.Takeup_Rate = Lead_Out.Takeup_Rate;
+  if (Lead_Out.Backlash_Left > Lead_Out.Backlash) {Lead_Out.Backlash_Left = Lead_Out.Backlash;}
+  if (Cross_Out.Backlash_Left > Cross_Out.Backlash) {Cross_Out.Backlash_Left = Cross_Out.Backlash;}
+  sei();
+}
+
+/**
+  @brief Points an axis at its pitch table and works out the correction where the axis is now.  That correction is
+         the starting point, nothing is owed for it, so the axis does not move at power up
+  @param Out      : axis output stage
+  @param Table    : correction in steps at each point
+  @param Points   : points in the table, at least 2
+  @param Spacing  : steps between points
+  @param Start    : Position of the first point
+*/
+void Comp_Begin(Axis_Output *Out, const long *Table, int Points, long Spacing, long Start) {
+  cli();
+  long Rel = Out->Position - Start;
+  int Index = 0;
+  if (Rel >= Spacing) {Index = Rel / Spacing; if (Index > Points - 2) {Index = Points - 2;}}
+  long Offset = Rel - Index * Spacing;
+  long Along = Offset;                                            // how far into the segment the interpolation has got
+  if (Along < 0) {Along = 0;}
+  if (Along > Spacing) {Along = Spacing;}
+  long long Span = (long long)(Table[Index + 1] - Table[Index]) * Along;
+  long long Whole = Span / Spacing;
+  long long Acc = Span - Whole * Spacing;
+  if (Acc < 0) {Acc += Spacing; Whole--;}                         // round toward minus infinity
+  Out->Comp_Table = Table;
+  Out->Comp_Points = Points;
+  Out->Comp_Spacing = Spacing;
+  Out->Comp_Start = Start;
+  Out->Comp_Index = Index;
+  Out->Comp_Offset = Offset;
+  Out->Comp_Acc = Acc;
+  Out->Comp_Value = Table[Index] + Whole;
+  sei();
+}
+
+/**
+  @brief Counts one logical step sent (or swallowed) and moves the pitch correction along with it
+  @param Out   : axis output stage
+  @param Step  : 1 or -1
+*/
+inline void Output_Logical(Axis_Output *Out, int Step) {
+  Out->Queue -= Step;
+  Out->Position += Step;
+  if (Out->Comp_Table == NULL) {return;}
+
+  long Spacing = Out->Comp_Spacing;
+  if (Step > 0) {
+    if (Out->Comp_Offset < 0 || Out->Comp_Offset >= Spacing) {Out->Comp_Offset++; return;}      // past an end of the table
+    Out->Comp_Offset++;
+    Out->Comp_Acc += Out->Comp_Table[Out->Comp_Index + 1] - Out->Comp_Table[Out->Comp_Index];
+  } else {
+    if (Out->Comp_Offset == 0 && Out->Comp_Index > 0) {Out->Comp_Index--; Out->Comp_Offset = Spacing; Out->Comp_Acc = 0;}
+    if (Out->Comp_Offset <= 0 || Out->Comp_Offset > Spacing) {Out->Comp_Offset--; return;}
+    Out->Comp_Offset--;
+    Out->Comp_Acc -= Out->Comp_Table[Out->Comp_Index + 1] - Out->Comp_Table[Out->Comp_Index];
+  }
+  while (Out->Comp_Acc >= Spacing) {Out->Comp_Acc -= Spacing; Out->Comp_Value++; Out->Comp_Owed++;}
+  while (Out->Comp_Acc < 0) {Out->Comp_Acc += Spacing; Out->Comp_Value--; Out->Comp_Owed--;}
+  if (Out->Comp_Offset == Spacing && Out->Comp_Index < Out->Comp_Points - 2) {Out->Comp_Index++; Out->Comp_Offset = 0;}    // Comp_Acc is 0 on a point
+}
+
+/**
+  @brief Sends at most one step on one axis, ran every tick
+  @param Out  : axis output stage
+*/
+void Output_Tick(Axis_Output *Out) {
+  if (Out->High) {digitalWriteFast(Out->Step_Pin, LOW); Out->High = 0; return;}      // end the pulse raised last tick, rest this tick
+  if (Out->Takeup_Credit < Step_Credit) {Out->Takeup_Credit += Out->Takeup_Rate;}
+
+  int Dir;
+  int Takeup = 0;
+  int Comp = 0;
+  if (Out->Queue != 0) {                                                                // a step of the move always goes first
+    Dir = Out->Queue > 0;
+    int Step = Dir ? 1 : -1;
+    if (Out->Comp_Owed * Step < 0 && Dir == Out->Dir_Level) {                           // correction against the travel, swallow this step
+      Output_Logical(Out, Step);
+      Out->Comp_Owed += Step;
+      Out->Extra -= Step;
+      return;
+    }
+  }
+  else if (Out->Takeup_Credit < Step_Credit || Out->Dir_Level == -1) {return;}
+  else if (Out->Backlash_Left > 0) {Dir = Out->Dir_Level; Takeup = 1;}
+  else if (Out->Comp_Owed != 0) {Dir = Out->Comp_Owed > 0; Comp = 1;}
+  else {return;}
+
+  if (Dir != Out->Dir_Level) {                                                          // let direction settle, step next tick
+    if (Out->Dir_Level == -1) {Out->Backlash_Left = 0;}                                  // first move, the slack is not known
+    else {Out->Backlash_Left = Out->Backlash - Out->Backlash_Left;}
+    digitalWriteFast(Out->Dir_Pin, Dir);
+    Out->Dir_Level = Dir;
+    return;
+  }
+  digitalWriteFast(Out->Step_Pin, HIGH);
+  Out->High = 1;
+  if (Takeup || Comp) {
+    Out->Extra += Dir ? 1 : -1;
+    Out->Takeup_Credit -= Step_Credit;
+    if (Takeup) {Out->Backlash_Left--;}
+    else {Out->Comp_Owed += Dir ? -1 : 1;}
+  } else {
+    Output_Logical(Out, Dir ? 1 : -1);
+  }
+}
+
+//----This is activated every "Step_Tick_US" to run the synchronized step generator and send the steps of both axes----//
+void Step_Tick() {
+  Sync_Step();
+  Output_Tick(&Lead_Out);
+  Output_Tick(&Cross_Out);
+}
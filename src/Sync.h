@@ -0,0 +1,351 @@
+/*
+  Spindle synchronized step generator.
+
+  Sync_Step() runs every Step_Tick_US from Step_Tick().  While a synchronized move is active it reads the
+  spindle encoder count and turns the change into progress along the move with an integer accumulator:
+  every count adds Sync_Num, every Sync_Den is one step of the dominant axis.  The other axis follows the
+  dominant one with a Bresenham error term, so both axes come from the same accumulator and the move is
+  exact over any length.  Everything runs in both directions, so the axes stay locked to the spindle
+  angle even if the spindle backs up.
+
+  A negative Sync_Num runs the move with the spindle turning in reverse: forward counts drive the progress back,
+  reverse counts drive it along.  With the move going the same way that gives the opposite hand of thread, so
+  left hand threads and right hand threads cut toward the tailstock are the same move with the sign changed.
+  The phase start then waits for the start angle coming round backward.
+
+  Steps go to the output stage (Step_Output.h), one at a time per axis, which drives the pins and adds any
+  backlash take-up.  Each axis earns step credit every tick at its max speed, so a ratio the motor can not
+  keep up with shows as a growing following error instead of lost steps, and trips the monitor in Follow.h.
+
+  Chip breaking maps each spindle count to accumulator progress through Sync_Break_Rate(): full rate for the
+  counts before the break, scaled up by window / feed counts, then nothing (pause) or back then forward (back off)
+  for the counts of the break.  The map is walked count by count in both directions, so backing the spindle up
+  retraces it exactly and the move stays locked to the spindle angle.
+
+  With Sync_Profile_On the cross slide is also driven straight off the spindle angle: the count since
+  Sync_Profile_Start, wrapped to one rev, looks up a steps offset in Sync_Profile that is added to the X target of
+  the move.  One lookup per tick, no maths, so the cross slide can follow several lobes a rev at its full speed.
+
+  A thread pass can start with a lead in ramp: for the first Sync_Ramp steps of progress the targets go along the
+  path as progress squared over twice Sync_Ramp, so the axes pick up speed at a steady rate, and after it they are
+  Sync_Ramp_Lead behind the progress.  The start count and the accumulator are set so the ramp ends on the start
+  angle with the accumulator exactly where an unramped start would have it, so the cut from there on is the same
+  one every pass, whatever the ramp.
+
+  With Sync_Z_Stop_On the leadscrew target is clamped at Sync_Z_Stop, so the leadscrew stops dead on it and waits
+  there while the spindle carries on.  The accumulator keeps counting, so once the spindle reverses back past
+  the stop the leadscrew follows it out again still locked to the spindle angle.
+
+  With Sync_Pull_On the cross slide pulls out at the end of a thread: every tick the leadscrew target is compared
+  with Sync_Pull_Z, and past it the X target is moved out Sync_Pull_Rise over Sync_Pull_Run leadscrew steps, a
+  straight line at the pull out angle.  The leadscrew stays locked to the spindle the whole time, so the run out
+  lands in the same place at any RPM and backing the spindle up runs the tool back down the same line.
+
+  Last of all both targets are bent onto the slow down into the soft stops (Soft_Stop.h), so nothing above can
+  step an axis past one.  Sync_Start() and Sync_Pull() work out how far each axis can go on the move, a move that
+  ends short of a stop is left alone and reaches its end exactly.
+*/
+
+/**
+  @brief Works out the leadscrew steps per spindle count for a lead on this lathe, see Sync_Lead_Ratio()
+  @param Lead         : dominant axis travel per spindle rev, in inch or mm
+  @param Lead_Metric  : 0 = Lead is in inch, 1 = Lead is in mm
+  @param Num          : steps per count numerator
+  @param Den          : steps per count denominator
+*/
+void Sync_Ratio(double Lead, int Lead_Metric, long long *Num, long long *Den) {
+  Sync_Lead_Ratio(Lead, Lead_Metric, LeadScrew_TPI * LeadSPR, (long long)SpindleCPR, Num, Den);
+}
+
+/**
+  @brief Works out chip breaking for a synchronized move from the settings
+  @param Window  : spindle counts from one break to the next
+  @param Cut     : counts of feed before each break
+  @return Chip_Break, or 0 if there is no break to make
+*/
+int Chip_Break_Plan(long *Window, long *Cut) {
+  if (Chip_Break == 0 || Chip_Break_Revs < 1) {return 0;}
+  *Window = Chip_Break_Revs * (long)SpindleCPR;
+  long Break = lround(Chip_Break_Degrees / 360 * SpindleCPR / 2) * 2;    // even, so a back off comes all the way back
+  long Most = *Window * Chip_Break_Max;
+  if (Break > Most) {Break = Most - Most % 2;}
+  if (Break <= 0) {return 0;}
+  *Cut = *Window - Break;
+  return Chip_Break;
+}
+
+/**
+  @brief Starts a synchronized straight move from the current stepper positions, the ISR owns both steppers
+         until Sync_Active drops back to 0
+  @param Z      : leadscrew end position in steps
+  @param X      : cross slide end position in steps
+  @param Num    : dominant axis steps per spindle count numerator, negative = the move runs with the spindle in reverse
+  @param Den    : dominant axis steps per spindle count denominator
+  @param Phase  : 1 = hold the move until the spindle comes round to angle zero, so every pass of a thread lands
+                  in the same groove.  0 = start straight away
+  @param Endless  : 1 = the targets follow the spindle past either end, the move only ends with Sync_Stop()
+  @param Angle    : with Phase 1, spindle counts past angle zero to start on instead, for the starts of a multi-start thread
+  @param Ramp     : with Phase 1, spindle counts before the start angle to ramp the axes up over, so they are at full
+                    speed and exactly where an unramped start would have them from the start angle on.  The move
+                    then starts Sync_Ramp_Lead_In() steps early.  0 = none
+*/
+void Sync_Start(long Z, long X, long long Num, long long Den, int Phase, int Endless, long Angle, long Ramp) {
+  Sync_Active = 0;
+  Sync_Endless = Endless;
+  Sync_Phase = Phase;
+  Sync_Phase_Wait = Phase;
+  Sync_Z_Pos = LeadScrew.currentPosition();
+  Sync_X_Pos = CrossSlide.currentPosition();
+  Sync_Z_Target = Sync_Z_Pos;
+  Sync_X_Target = Sync_X_Pos;
+  long DZ = Z - Sync_Z_Pos;
+  long DX = X - Sync_X_Pos;
+
+  Sync_Major_Is_X = labs(DX) > labs(DZ);
+  if (Sync_Major_Is_X) {
+    Sync_Length = labs(DX); Sync_Minor_Length = labs(DZ);
+    Sync_Major_Dir = (DX < 0) ? -1 : 1; Sync_Minor_Dir = (DZ < 0) ? -1 : 1;
+  } else {
+    Sync_Length = labs(DZ); Sync_Minor_Length = labs(DX);
+    Sync_Major_Dir = (DZ < 0) ? -1 : 1; Sync_Minor_Dir = (DX < 0) ? -1 : 1;
+  }
+  Sync_Minor_Err = Sync_Length / 2;
+  if (Endless == 1) {Sync_Z_Low = -Sync_Reach_All; Sync_Z_High = Sync_Reach_All; Sync_X_Low = -Sync_Reach_All; Sync_X_High = Sync_Reach_All;}
+  else {
+    Sync_Z_Low = (Z < Sync_Z_Pos) ? Z : Sync_Z_Pos; Sync_Z_High = (Z > Sync_Z_Pos) ? Z : Sync_Z_Pos;
+    Sync_X_Low = (X < Sync_X_Pos) ? X : Sync_X_Pos; Sync_X_High = (X > Sync_X_Pos) ? X : Sync_X_Pos;
+    if (Sync_Profile_On == 1) {                               // the profile only ever adds to the retract side
+      if (Retract_Dir > 0) {Sync_X_High = Sync_Reach_All;} else {Sync_X_Low = -Sync_Reach_All;}
+    }
+  }
+  Soft_Stop_Begin(&Z_Soft, Sync_Z_Pos);
+  Soft_Stop_Begin(&X_Soft, Sync_X_Pos);
+  Sync_Num = Num;
+  Sync_Den = Den;
+  Sync_Acc_Num = Num;
+  Sync_Acc_Den = Den;
+  Sync_Break_Type = (Phase == 0) ? Chip_Break_Plan(&Sync_Break_Window, &Sync_Break_Cut) : 0;   // never on a thread
+  Sync_Break_Phase = 0;
+  if (Sync_Break_Type != 0) {Sync_Acc_Num = Num * Sync_Break_Window; Sync_Acc_Den = Den * Sync_Break_Cut;}
+  Sync_Acc = 0;
+  Sync_Progress = 0;
+  Sync_Path = 0;
+  Sync_Ramp = 0;
+  Sync_Ramp_Lead = 0;
+  if (Phase == 1 && Endless == 0 && Ramp > 0) {
+    Sync_Ramp = Sync_Ramp_Steps(Num, Den, Ramp);
+    Sync_Ramp_Lead = (Sync_Ramp + 1) / 2;
+    Sync_Acc = Sync_Ramp * Den - Ramp * llabs(Num);           // lands the progress on Sync_Ramp exactly at the start angle
+  }
+  Sync_Z_Credit = 0;
+  Sync_X_Credit = 0;
+  Sync_Pull_On = 0;                                           // armed again with Sync_Pull() by moves that want it
+
+  cli();
+  int32_t Count = spindle.read();
+  sei();
+  if (Phase == 1) {                                           // start counting from the next spindle angle zero, or Angle past it
+    int32_t CPR = SpindleCPR;
+    int32_t Pre = (Sync_Ramp > 0) ? Ramp : 0;                 // the ramp runs before the start angle
+    if (Num < 0) {Pre = -Pre;}
+    Count += Pre;
+    int32_t Past = (Count - Angle) % CPR;
+    if (Past < 0) {Past += CPR;}
+    if (Num < 0) {Count = Count - Past;}                     // spindle in reverse, the angle comes round from above
+    else if (Past != 0) {Count = Count + (CPR - Past);}
+    Count -= Pre;
+  }
+  Sync_Last_Count = Count;                                    // counts before this point drive the progress negative, the axes wait at the start
+  Sync_Profile_Start = Count;
+  Sync_Done = 0;
+  Sync_Active = 1;
+}
+
+/**
+  @brief Progress steps a lead in ramp takes, the dominant axis travel at full speed over its counts
+  @param Num     : dominant axis steps per spindle count numerator
+  @param Den     : dominant axis steps per spindle count denominator
+  @param Counts  : spindle counts of ramp
+*/
+long Sync_Ramp_Steps(long long Num, long long Den, long Counts) {
+  return (Counts * llabs(Num) + Den - 1) / Den;
+}
+
+/**
+  @brief Spindle counts of lead in ramp that bring the dominant axis up to full speed at an acceleration
+  @param Num    : dominant axis steps per spindle count numerator
+  @param Den    : dominant axis steps per spindle count denominator
+  @param RPM    : spindle speed the ramp is planned for
+  @param Accel  : dominant axis steps/sec/sec
+*/
+long Sync_Ramp_Counts(long long Num, long long Den, double RPM, double Accel) {
+  double Counts_Per_Sec = fabs(RPM) * SpindleCPR / 60;
+  double Rate = Counts_Per_Sec * llabs(Num) / Den;            // steps/sec at full speed
+  if (Rate <= 0 || Accel <= 0) {return 0;}
+  return ceil(Counts_Per_Sec * Rate / Accel);                 // counts over the Rate / Accel seconds of ramp
+}
+
+/**
+  @brief Dominant axis steps a lead in ramp travels before the axis is at full speed, how far before the start
+         of the cut a ramped move has to begin
+  @param Num     : dominant axis steps per spindle count numerator
+  @param Den     : dominant axis steps per spindle count denominator
+  @param Counts  : spindle counts of ramp
+*/
+long Sync_Ramp_Lead_In(long long Num, long long Den, long Counts) {
+  if (Counts <= 0) {return 0;}
+  return (Sync_Ramp_Steps(Num, Den, Counts) + 1) / 2;
+}
+
+/**
+  @brief Arms the thread end pull out on the running move, call with interrupts off.  Cleared by Sync_Start() and Sync_Stop()
+  @param Z     : leadscrew position the pull out starts at
+  @param Dir   : way the leadscrew runs toward Z, 1 or -1
+  @param Run   : leadscrew steps past Z the cross slide takes to pull out
+  @param Rise  : cross slide steps out, away from the spindle axis, at the end of the pull out
+*/
+void Sync_Pull(long Z, int Dir, long Run, long Rise) {
+  Sync_Pull_Z = Z;
+  Sync_Pull_Dir = Dir;
+  Sync_Pull_Run = (Run < 1) ? 1 : Run;
+  Sync_Pull_Rise = Rise;
+  Sync_Pull_On = 1;
+  if (Sync_Endless == 0) {                                    // the pull out takes the cross slide past the end of the move
+    if (Retract_Dir > 0) {Sync_X_High += Rise;} else {Sync_X_Low -= Rise;}
+  }
+}
+
+/**
+  @brief Locks the leadscrew to the spindle with no end point, for Feed and Thread mode.  Holds until Sync_Stop()
+  @param Num    : leadscrew steps per spindle count numerator
+  @param Den    : leadscrew steps per spindle count denominator
+  @param Phase  : 1 = from the next spindle angle zero and never chip breaking, for threads
+  @param Dir    : 1 = the leadscrew steps + with the spindle turning forward, -1 = - for a left hand thread
+*/
+void Sync_Lock(long long Num, long long Den, int Phase, int Dir) {
+  Follow_Peak = 0;                                  // each lock is a new cut, like Cycle_Begin() for the cycles
+  Sync_Start(LeadScrew.currentPosition() + Dir, CrossSlide.currentPosition(), Num, Den, Phase, 1);
+}
+
+/** @brief Stops a synchronized move where it is and hands the positions back to AccelStepper */
+void Sync_Stop() {
+  Sync_Active = 0;
+  Sync_Endless = 0;
+  Sync_Profile_On = 0;
+  Sync_Z_Stop_On = 0;
+  Sync_Pull_On = 0;
+  LeadScrew.setCurrentPosition(Sync_Z_Pos);
+  CrossSlide.setCurrentPosition(Sync_X_Pos);
+}
+
+/**
+  @brief Moves the move targets one step along the path, forward (Dir = 1) or back (Dir = -1)
+*/
+inline void Sync_Path_Step(int Dir) {
+  Sync_Path += Dir;
+  long Minor_Step = 0;
+  if (Dir > 0) {
+    Sync_Minor_Err += Sync_Minor_Length;
+    if (Sync_Minor_Err >= Sync_Length) {Sync_Minor_Err -= Sync_Length; Minor_Step = Sync_Minor_Dir;}
+  } else {                                                    // exact reverse of the forward step
+    Sync_Minor_Err -= Sync_Minor_Length;
+    if (Sync_Minor_Err < 0) {Sync_Minor_Err += Sync_Length; Minor_Step = -Sync_Minor_Dir;}
+  }
+  if (Sync_Major_Is_X) {Sync_X_Target += Dir * Sync_Major_Dir; Sync_Z_Target += Minor_Step;}
+  else {Sync_Z_Target += Dir * Sync_Major_Dir; Sync_X_Target += Minor_Step;}
+}
+
+/**
+  @brief Moves the progress one step forward (Dir = 1) or back (Dir = -1) and brings the targets to the path
+         point for it.  Progress outside 0 to Sync_Length is counted but does not move the targets, and over the
+         first Sync_Ramp steps of progress the path point goes as progress squared, so the axes ramp up to speed
+*/
+inline void Sync_Advance(int Dir) {
+  Sync_Progress += Dir;
+  if (Sync_Endless == 1) {
+    if (Sync_Phase_Wait == 1) {                               // an endless lock waits for angle zero once, then has no ends
+      if (Sync_Progress <= 0) {return;}
+      Sync_Phase_Wait = 0;
+    }
+    Sync_Path_Step(Dir);
+    return;
+  }
+  long Want = Sync_Progress;
+  if (Sync_Ramp > 0 && Want > 0) {
+    if (Want < Sync_Ramp) {Want = ((long long)Want * Want + Sync_Ramp) / (2LL * Sync_Ramp);}
+    else {Want = Want - Sync_Ramp + Sync_Ramp_Lead;}
+  }
+  if (Want < 0) {Want = 0;}
+  if (Want > Sync_Length) {Want = Sync_Length;}
+  while (Sync_Path < Want) {Sync_Path_Step(1);}
+  while (Sync_Path > Want) {Sync_Path_Step(-1);}
+}
+
+/** @brief Accumulator progress for the spindle count at Phase in the chip breaking window
+    @param Phase  : counts into the window
+*/
+inline long long Sync_Break_Rate(long Phase) {
+  if (Phase < Sync_Break_Cut) {return Sync_Acc_Num;}
+  if (Sync_Break_Type == 1) {return 0;}                                                     // pause
+  if (Phase < Sync_Break_Cut + (Sync_Break_Window - Sync_Break_Cut) / 2) {return -Sync_Acc_Num;}   // back off, then come back
+  return Sync_Acc_Num;
+}
+
+//----This is activated every "Step_Tick_US" to step the leadscrew and cross slide in sync with the spindle----//
+void Sync_Step() {
+  if (Sync_Active == 0) {return;}
+
+  int32_t Count = spindle.read();
+  int32_t Delta = Count - Sync_Last_Count;
+  Sync_Last_Count = Count;
+  if (Sync_Break_Type == 0) {Sync_Acc += Delta * Sync_Acc_Num;}
+  else {
+    for (; Delta > 0; Delta--) {
+      Sync_Acc += Sync_Break_Rate(Sync_Break_Phase);
+      if (++Sync_Break_Phase == Sync_Break_Window) {Sync_Break_Phase = 0;}
+    }
+    for (; Delta < 0; Delta++) {
+      if (Sync_Break_Phase == 0) {Sync_Break_Phase = Sync_Break_Window;}
+      Sync_Acc -= Sync_Break_Rate(--Sync_Break_Phase);
+    }
+  }
+  while (Sync_Acc >= Sync_Acc_Den) {Sync_Acc -= Sync_Acc_Den; Sync_Advance(1);}
+  while (Sync_Acc < 0) {Sync_Acc += Sync_Acc_Den; Sync_Advance(-1);}
+
+  long Z_Target = Sync_Z_Target;
+  if (Sync_Z_Stop_On == 1 && (Z_Target - Sync_Z_Stop) * Sync_Z_Stop_Dir > 0) {Z_Target = Sync_Z_Stop;}    // held at the stop
+  long X_Target = Sync_X_Target;
+  if (Sync_Pull_On == 1) {                                                                 // position compare for the thread end pull out
+    long Past = (Z_Target - Sync_Pull_Z) * Sync_Pull_Dir;
+    if (Past >= Sync_Pull_Run) {X_Target += Retract_Dir * Sync_Pull_Rise;}
+    else if (Past > 0) {X_Target += Retract_Dir * (long)((long long)Past * Sync_Pull_Rise / Sync_Pull_Run);}
+  }
+  if (Sync_Profile_On == 1) {
+    int32_t Angle = Count - Sync_Profile_Start;
+    if (Angle >= 0) {X_Target += Retract_Dir * Sync_Profile[Angle % Sync_Profile_Length];}   // nothing before angle zero, the table starts at 0
+  }
+  Z_Target = Soft_Stop_Shape(&Z_Soft, Z_Target, Sync_Z_Low, Sync_Z_High);                  // slows into the soft stops, Soft_Stop.h
+  X_Target = Soft_Stop_Shape(&X_Soft, X_Target, Sync_X_Low, Sync_X_High);
+
+  if (Sync_Z_Credit < Step_Credit) {Sync_Z_Credit += Sync_Z_Rate;}
+  if (Sync_X_Credit < Step_Credit) {Sync_X_Credit += Sync_X_Rate;}
+  if (Sync_Z_Pos != Z_Target && Lead_Out.Queue == 0 && Sync_Z_Credit >= Step_Credit) {           // one step waiting at a time
+    long Step = (Z_Target > Sync_Z_Pos) ? 1 : -1;
+    Sync_Z_Pos += Step; Lead_Out.Queue += Step; Sync_Z_Credit -= Step_Credit;
+  }
+  if (Sync_X_Pos != X_Target && Cross_Out.Queue == 0 && Sync_X_Credit >= Step_Credit) {
+    long Step = (X_Target > Sync_X_Pos) ? 1 : -1;
+    Sync_X_Pos += Step; Cross_Out.Queue += Step; Sync_X_Credit -= Step_Credit;
+  }
+
+  long Error = Z_Target - Sync_Z_Pos;
+  long Error_X = X_Target - Sync_X_Pos;
+  if (labs(Error_X) > labs(Error)) {Error = Error_X;}
+  Follow_Check(Error);
+  if (Follow_Tripped == 1) {Sync_Active = 0; return;}                                   // feed hold right here, Follow_Update() retracts
+
+  if (Sync_Endless == 0 && Sync_Path >= Sync_Length && Sync_Z_Pos == Z_Target && Sync_X_Pos == X_Target) {
+    Sync_Active = 0;
+    Sync_Done = 1;
+  }
+}
@@ -0,0 +1,60 @@
+/*
+  Taper turning, ran as a canned cycle (Cycles.h).
+
+  Touch the tool off on the larger diameter at the tailstock end of the taper and start the cycle.  Each
+  pass feeds along the taper line from the tailstock end toward the headstock at the Z feed per rev, the
+  cross slide follows at the exact ratio of the taper's X and Z step counts.  Roughing passes offset the
+  line outward by what is left to cut, the finishing pass cuts the final line.
+*/
+void Taper() {
+  if (status == 0) {Taper_Plan(); Cycle_Begin(Taper_Pass);}
+  Cycle_Run();
+}
+
+/** @brief Works the taper out in steps from the inputs, ran when the cycle starts */
+void Taper_Plan() {
+  double Start_Dia, End_Dia, Length, DOC, Finish;
+  if (Metric == 0) {Start_Dia = in_Outside_Diameter; End_Dia = in_Final_Diameter; Length = in_length_of_cut; DOC = in_DOC; Finish = final_pass_in;}
+  else {Start_Dia = mm_Outside_Diameter; End_Dia = mm_Final_Diameter; Length = mm_length_of_cut; DOC = mm_DOC; Finish = final_pass_mm;}
+  if (Taper_type == 1) {End_Dia = Start_Dia - 2 * Length * tan(Taper_Angle * PI / 180);}
+  if (End_Dia < 0) {End_Dia = 0;}
+  double Stock = fmax(Start_Dia, End_Dia);
+
+  Taper_Length = Cycle_Steps(Length);
+  Taper_Start_X = Cycle_Steps((Start_Dia - Stock) / 2);
+  Taper_End_X = Cycle_Steps((End_Dia - Stock) / 2);
+  long Depth = labs(Taper_Start_X - Taper_End_X);
+  Taper_DOC = Cycle_Steps(DOC);
+  if (Taper_DOC < 1) {Taper_DOC = 1;}
+  Taper_Finish = Cycle_Steps(Finish);
+  if (Taper_Finish > Depth) {Taper_Finish = Depth;}
+  Taper_Passes = (Depth - Taper_Finish + Taper_DOC - 1) / Taper_DOC;
+  if (Taper_Length <= 0) {Taper_Passes = -1;}                         // nothing to cut
+}
+
+/**
+  @brief Queues one pass of the taper cycle: roughing passes, the finishing pass, then the return to the start
+  @param Pass  : pass number from 0
+*/
+int Taper_Pass(int Pass) {
+  if (Taper_Passes < 0) {return 0;}
+  int Finish_Pass = (Taper_Finish > 0) ? 1 : 0;
+  if (Pass > Taper_Passes + Finish_Pass) {return 0;}
+  if (Pass == Taper_Passes + Finish_Pass) {Cycle_Rapid(0, 0); return 1;}
+
+  long Offset = 0;                                                    // finishing pass cuts the line itself
+  if (Pass < Taper_Passes) {Offset = labs(Taper_Start_X - Taper_End_X) - (Pass + 1) * Taper_DOC;}
+  if (Pass < Taper_Passes && Offset < Taper_Finish) {Offset = Taper_Finish;}
+  long Clear = Cycle_Steps((Metric == 0) ? in_Cycle_Clear : mm_Cycle_Clear);
+  long X0 = Taper_Start_X + Offset;
+  long X1 = Taper_End_X + Offset;
+  long Top = ((X0 > X1) ? X0 : X1) + Clear;
+  double Feed = (Metric == 0) ? In_FeedRate : mm_FeedRate;
+
+  Cycle_Rapid(Clear, X0);
+  Cycle_Feed(0, X0, Feed, 0);                                         // feed in to the end of the work, the taper starts on a step
+  Cycle_Feed(-Taper_Length, X1, Feed, 0);
+  Cycle_Rapid(-Taper_Length, Top);
+  Cycle_Rapid(Clear, Top);
+  return 1;
+}
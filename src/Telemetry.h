@@ -0,0 +1,63 @@
+//----This is activated every "Telemetry_Period_US" to take one Stream_Motion sample----//
+void Telemetry_Sample() {
+  if ((Protocol_Streams & Stream_Motion) == 0) {return;}
+  if (Telemetry_Full[Telemetry_Fill] == 1) {Telemetry_Dropped++; return;}     // both blocks waiting on USB, never wait here
+
+  Motion_Sample *Sample = &Telemetry_Block[Telemetry_Fill][Telemetry_Fill_Count];
+  Sample->Time_US = micros();
+  Sample->Spindle_Count = spindle.read();
+  Sample->Spindle_RPM = SpindleRPM;
+  Sample->Queue_Depth = Planner_Count();
+  if (Sync_Active == 1) {
+    Sample->Lead_Pos = Sync_Z_Pos;
+    Sample->Lead_Target = Sync_Z_Target;
+    Sample->Cross_Pos = Sync_X_Pos;
+    Sample->Cross_Target = Sync_X_Target;
+    Sample->Follow_Error = Follow_Error;
+    Sample->Flags = Motion_Sync;
+  } else {
+    Sample->Lead_Pos = LeadScrew.currentPosition();
+    Sample->Lead_Target = LeadScrew.targetPosition();
+    Sample->Cross_Pos = CrossSlide.currentPosition();
+    Sample->Cross_Target = CrossSlide.targetPosition();
+    Sample->Follow_Error = (Mode_Array_Pos == 1) ? Follow_Error : 0;
+    Sample->Flags = 0;
+  }
+
+  Telemetry_Fill_Count++;
+  if (Telemetry_Fill_Count == Motion_Block_Samples) {
+    Telemetry_Full[Telemetry_Fill] = 1;
+    Telemetry_Fill = 1 - Telemetry_Fill;
+    Telemetry_Fill_Count = 0;
+  }
+}
+
+/** @brief Sends a full block of motion samples if USB has room for the whole frame right now, ran once per loop() */
+void Telemetry_Update() {
+  if (Telemetry_Full[Telemetry_Send] == 0) {return;}
+  if (Serial.availableForWrite() < Protocol_Max_Encoded) {return;}          // try again next pass, the sampler keeps the other block
+
+  uint8_t Payload[Protocol_Max_Payload];
+  cli();
+  uint16_t Dropped = Telemetry_Dropped;
+  Telemetry_Dropped = 0;
+  sei();
+  Protocol_Put_U16(Payload, Dropped);
+  Payload[2] = Motion_Block_Samples;
+  memcpy(Payload + 3, Telemetry_Block[Telemetry_Send], sizeof(Telemetry_Block[0]));
+  Telemetry_Full[Telemetry_Send] = 0;                                        // block is copied, the sampler may refill it
+  Telemetry_Send = 1 - Telemetry_Send;
+  Protocol_Send(Msg_Motion, Protocol_Tx_Seq++, Payload, 3 + sizeof(Telemetry_Block[0]));
+}
+
+/** @brief Empties both sample blocks, used when the host subscribes to Stream_Motion */
+void Telemetry_Reset() {
+  cli();
+  Telemetry_Fill = 0;
+  Telemetry_Fill_Count = 0;
+  Telemetry_Full[0] = 0;
+  Telemetry_Full[1] = 0;
+  Telemetry_Send = 0;
+  Telemetry_Dropped = 0;
+  sei();
+}
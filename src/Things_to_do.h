@@ -28,8 +28,6 @@ Move to position based off of metric numbers may have significant rounding error
 external and internal threading
 internal and external boring
 internal and external radius
-internal and external chamfer
-ball turning
 taper turning
 Knurling?  https:ww.youtube.com/watch?v=E2niXyOQSOA
 
@@ -1,41 +1,212 @@
 // https://www.machiningdoctor.com/charts/metric-thread-charts/
 // https://www.machiningdoctor.com/charts/unified-inch-threads-charts/
+/*
+  Thread mode locks the leadscrew to the spindle count through the synchronized step generator (Sync.h), at the
+  exact ratio for the TPI or pitch, from spindle angle zero.  The lock holds through spindle reversal, so the spindle
+  can be run backward to back the tool out of the thread, or a tap out of the hole, and forward again into the same
+  groove without opening the half nut.  With in_Thread_Stop set the leadscrew stops dead that far along from where
+  the lock was taken and waits there for the spindle to reverse.  A left hand thread runs the leadscrew the other
+  way for the same spindle direction.  With Thread_Pull_Angle set as well the cross slide pulls the tool out of the
+  thread along that angle as the leadscrew runs up to the stop, so the thread runs out instead of ending in a step.
+*/
 void Thread() {
-  double stepsPerSec;
-  if (Thread_Mode == 0) {            //----Inch Threading----//
-    TPI = TPI_Array[TPI_Array_Pos];
-    rpm = ((LeadScrew_TPI*(SpindleRPM))/(TPI * TPI));        // This outputs Leadscrew RPM
-  } 
-  else if (Thread_Mode == 1) {    //----Metric Threading----//
-    Pitch = Pitch_Array[Pitch_Array_Pos];
-    rpm = .00155*SpindleRPM*LeadScrew_TPI*(Pitch*Pitch);
+  if (Follow_Hold == 1) {return;}                                   // following error trip, stay put until the spindle stops
+  if (Thread_Mode == 0) {TPI = TPI_Array[TPI_Array_Pos];}            //----Inch Threading----//
+  else if (Thread_Mode == 1) {Pitch = Pitch_Array[Pitch_Array_Pos];}  //----Metric Threading----//
+  long long Num, Den;
+  Thread_Ratio(&Num, &Den);
+  int Dir = (Thread_Hand == 1) ? -1 : 1;
+  if (Sync_Active == 0 || Sync_Endless == 0 || Num != Sync_Num || Den != Sync_Den || Sync_Phase != 1 || Sync_Major_Dir != Dir) {
+    if (Sync_Active == 1 || Sync_Endless == 1) {Sync_Stop();}
+    Thread_Start_Z = LeadScrew.currentPosition();
+    Sync_Lock(Num, Den, 1, Dir);
+  }
+
+  double Stop = (Thread_Mode == 0) ? in_Thread_Stop : mm_Thread_Stop / 25.4;
+  long Stop_Steps = lround(Stop * LeadScrew_TPI * LeadSPR);
+  cli();
+  Sync_Z_Stop = Thread_Start_Z + Dir * Stop_Steps;                  // the way the leadscrew runs with the spindle forward
+  Sync_Z_Stop_Dir = Dir;
+  Sync_Z_Stop_On = Stop_Steps > 0;
+  sei();
+
+  double Form = .625 * .866025404 * ((Thread_Mode == 0) ? 1 / TPI : Pitch);   // same depth as the minor diameter works out
+  long Rise = Thread_Steps(Form);
+  long Run = Thread_Pull_Run(Rise);
+  cli();
+  if (Stop_Steps > 0 && Run > 0) {Sync_Pull(Sync_Z_Stop - Dir * Run, Dir, Run, Rise);}   // out of the thread by the time it reaches the stop
+  else {Sync_Pull_On = 0;}
+  sei();
+}
+
+/** @brief Leadscrew steps the thread end pull out takes to pull the tool out by Rise along Thread_Pull_Angle, 0 = off
+    @param Rise  : cross slide steps out
+*/
+long Thread_Pull_Run(long Rise) {
+  if (Thread_Pull_Angle <= 0 || Rise <= 0) {return 0;}
+  long Run = lround(Rise / tan(Thread_Pull_Angle * PI / 180));
+  return (Run < 1) ? 1 : Run;
+}
+
+/**
+  @brief Leadscrew steps per spindle count for the selected TPI or Pitch, exact for every entry
+  @param Num  : steps per count numerator
+  @param Den  : steps per count denominator
+*/
+void Thread_Ratio(long long *Num, long long *Den) {
+  if (Thread_Mode == 0) {
+    Sync_TPI_Ratio(llround(TPI), llround(LeadScrew_TPI * LeadSPR), llround(SpindleCPR), Num, Den);
+  } else {
+    Sync_Ratio(Pitch, 1, Num, Den);
   }
-  stepsPerSec = ((rpm/60)*LeadSPR);     
-  LeadScrew.setSpeed(stepsPerSec);
 }
 
+/*
+  Auto Thread, ran as a canned cycle (Cycles.h).
+
+  Each pass feeds in by the cross slide, cuts the thread length with the leadscrew locked to the spindle at the
+  exact TPI or pitch ratio, and rapids back out and home.  The passes get shallower as they go so each takes off
+  about the same area of chip, in_DOC is the first, then the full depth is cut again as a spring pass.  A thread
+  with Thread_Starts starts cuts each start from its own spindle angle, 360/Thread_Starts degrees apart counted from
+  the encoder, and takes every start down to the same depth before going deeper, so the starts share the load and
+  never need indexing by hand.  The TPI or pitch selected is the pitch, the distance from one groove to the next,
+  and sets the depth.  The leadscrew runs at the lead, the pitch times the starts.
+
+  Touch the tool off on the thread OD where the thread starts.  Cutting toward the headstock (Direction_Array
+  Forward) that is the end of the work: every pass leads in from the clearance off the end and pulls out where the
+  thread ends, at the shoulder or in its relief groove.  Cutting toward the tailstock (Reverse) it is the shoulder
+  end: every pass starts there in the relief groove and runs the clearance off the end of the work before pulling
+  out.  A right hand thread cut toward the headstock, or a left hand thread cut toward the tailstock, runs with the
+  spindle forward, the other two with it in reverse.  Either way every pass starts on the same spindle angle.
+
+  The leadscrew can't go from a stop to thread speed in one step, so each pass starts Thread_Lead_In early and
+  ramps up at the rapid acceleration over Thread_Ramp spindle counts, planned for the spindle speed when the cycle
+  starts.  The start angle is put back by the ramp (Sync_Start()), so the leadscrew is at full speed and exactly
+  in the groove by the time it reaches the work.  Cutting toward the headstock the lead in is taken off the end,
+  toward the tailstock it comes out of the relief groove, which has to be at least the lead in wide.  The start
+  page shows the lead in and the fastest spindle the leadscrew can keep up with, speeding the spindle up after
+  the start takes more lead in than was planned.
+
+  With Thread_Pull_Angle set every pass pulls out to the thread OD along that angle, reaching it where the pass
+  ends, so all the passes run out along the one line and the thread ends in a clean run out instead of a step.
+  The pull out runs at the leadscrew's speed times the tangent of the angle, steep angles at a high RPM can ask
+  more of the cross slide than it has and trip the following error monitor.
+
+  NPT and BSPT pipe threads take their TPI, depth and length from the tables in Header.h.  Turn the blank to the
+  1:16 taper first and touch off on its end at the start of the thread.  The cross slide then follows the taper as
+  the leadscrew feeds, both off the one spindle count: X is the minor axis of the synchronized move, so its steps
+  per count are the exact leadscrew ratio times the rise over the length.
+*/
 void Auto_Thread() {
-  // use "Encoder_Angle" to save the spindle angle when starting the thread, and then use the saved value to start the thread
-  // may have to parse info to and from "Spindle_Angle()"
-  // add a thread root? calculate proper dims based off of thread?
-  // due to the 2 steppers going on the crossslide and lead screw axis, in threading this could cause the cutter to cut on both sides
-    // -to fix this calculate the extra lead that the lead screw should start, and start it early so the cut stays on the leading edge of the tool
+  if (status == -1) {Thread_Plan();}                                  // keeps the depth and lead in on the screens current
+  if (status == 0) {Thread_Plan(); Cycle_Begin(Thread_Pass);}
+  Cycle_Run();
+}
 
-  /* Variables that are already declared: 
-      in_DOC / mm_DOC - depth of cutting pass - user input
-      in_Outside_Diameter / mm_Outside_Diameter - Outer Diameter of thread - user input
-      in_length_of_cut / mm_length_of_cut - Length of thread - user input
-      in_Thread_Depth / mm_Thread_Depth - total depth of thread - calculated
-  */
+/** @brief Length in whole steps in the units of the selected thread, which can differ from Metric
+    @param Length  : inch for TPI, mm for Pitch
+*/
+long Thread_Steps(double Length) {
+  if (Thread_Mode == 0) {return lround(Length / .001 * Steps_Per_Thou);}
+  return lround(Length / .01 * Steps_Per_hundredth_mm);
+}
 
-  Spindle_Angle();                      // will need to be continuously polled inorder to start at the same angle with each restart
+/** @brief Works the thread out in steps from the inputs, ran when the cycle starts */
+void Thread_Plan() {
+  Auto_Thread_Depth();
+  if (Thread_Taper == 0) {Thread_Ratio(&Thread_Num, &Thread_Den);}
+  else {                                                              // counted in half threads so 11.5 TPI is exact
+    Thread_Num = llround(LeadScrew_TPI * LeadSPR) * 2;
+    Thread_Den = llround(Pipe_TPI() * 2) * llround(SpindleCPR);
+  }
+  Thread_Starts = constrain(Thread_Starts, 1, Thread_Starts_Max);
+  Thread_Num *= Thread_Starts;                                        // the selection is the pitch, the lead is pitch * starts
+  Thread_Dir = (Direction_Array_Pos == 1) ? 1 : -1;
+  if ((Thread_Hand == 1) != (Direction_Array_Pos == 1)) {Thread_Num = -Thread_Num;}   // cut with the spindle in reverse
+  Thread_Length = Thread_Steps((Thread_Mode == 0) ? in_length_of_cut : mm_length_of_cut);
+  Thread_Depth = Thread_Steps((Thread_Mode == 0) ? in_Thread_Depth : mm_Thread_Depth);
+  Thread_DOC = Thread_Steps((Thread_Mode == 0) ? in_DOC : mm_DOC);
+  if (Thread_DOC < 1) {Thread_DOC = 1;}
+  if (Thread_DOC > Thread_Depth) {Thread_DOC = Thread_Depth;}
+  double Ratio = (double)Thread_Depth / fmax(Thread_DOC, 1);
+  Thread_Levels = ceil(Ratio * Ratio - .001);                         // depth of pass N is in_DOC * sqrt(N)
+  Thread_Max_RPM = LeadSpeed * 60 * Thread_Den / ((double)llabs(Thread_Num) * SpindleCPR);
+  Thread_Ramp = Sync_Ramp_Counts(Thread_Num, Thread_Den, SpindleRPM, LeadSpeed / Rapid_Ramp_Time);
+  Thread_Lead_In = Sync_Ramp_Lead_In(Thread_Num, Thread_Den, Thread_Ramp);
+  long Clear = Thread_Steps((Thread_Mode == 0) ? in_Cycle_Clear : mm_Cycle_Clear);
+  long Lead = Clear;
+  if (Thread_Lead_In > Lead) {Lead = Thread_Lead_In;}                 // up to speed by the time the tool reaches the work
+  long Groove = Thread_Lead_In;                                       // ramp room in the relief groove
+  if (Thread_Taper != 0) {                                            // whole steps of rise, so the taper is exactly 1:16
+    Thread_Length = Thread_Length / Pipe_Taper * Pipe_Taper;
+    Clear = (Clear + Pipe_Taper - 1) / Pipe_Taper * Pipe_Taper;
+    Lead = (Lead + Pipe_Taper - 1) / Pipe_Taper * Pipe_Taper;
+    Groove = (Groove + Pipe_Taper - 1) / Pipe_Taper * Pipe_Taper;
+  }
+  if (Thread_Dir < 0) {Thread_Z_Start = Lead; Thread_Z_End = -Thread_Length;}   // in off the end, out at the shoulder
+  else {Thread_Z_Start = -Groove; Thread_Z_End = Thread_Length + Clear;}       // in from the groove, out off the end
+  if (Thread_Length <= 0 || Thread_Depth <= 0) {Thread_Levels = -1;}  // nothing to cut
+}
 
-  //----Calculate Thread Depth----//      // NEED TO DO: convert these to step length, rebuild only when changed
-  if (Thread_Mode == 0 && SpindleRPM == 0) {in_Minor_Diameter();}  // dont want to do unneccessary calcs while the spindle is turning
-  if (Thread_Mode == 1 && SpindleRPM == 0) {mm_Minor_Diameter();}  // dont want to do unneccessary calcs while the spindle is turning
+/** @brief Cross slide steps from the touch off to the thread OD at a cycle Z, it grows toward the headstock on a pipe thread
+    @param Z  : leadscrew position in steps from the cycle start, a whole number of Pipe_Taper
+*/
+long Thread_Surface(long Z) {
+  if (Thread_Taper == 0) {return 0;}
+  return -Z / Pipe_Taper;
+}
+
+/**
+  @brief Queues one pass of one start, interleaved so every start is cut to a depth before any goes deeper,
+         then the spring passes and the return to the start
+  @param Pass  : pass number from 0
+*/
+int Thread_Pass(int Pass) {
+  if (Thread_Levels < 0) {return 0;}
+  int Passes = (Thread_Levels + 1) * Thread_Starts;                   // the last level of each start is its spring pass
+  if (Pass > Passes) {return 0;}
+  if (Pass == Passes) {Cycle_Rapid(0, 0); return 1;}
+  int Level = Pass / Thread_Starts + 1;
+  int Start = Pass % Thread_Starts;
+  long Depth = Thread_Depth;
+  if (Level < Thread_Levels) {Depth = lround(Thread_DOC * sqrt((double)Level));}
+  if (Depth > Thread_Depth) {Depth = Thread_Depth;}
+  long Clear = Thread_Steps((Thread_Mode == 0) ? in_Cycle_Clear : mm_Cycle_Clear);
+  long Angle = lround(SpindleCPR * Start / Thread_Starts);            // counts past angle zero for this start
 
-  //start feed if Current Encoder angle == original encoder angle
+  Cycle_Rapid(Thread_Z_Start, Thread_Surface(Thread_Z_Start) - Depth);
+  Cycle_Thread(Thread_Z_End, Thread_Surface(Thread_Z_End) - Depth, Thread_Num, Thread_Den, Angle, Thread_Ramp, Thread_Pull_Run(Depth), Depth);
+  Cycle_Rapid(Thread_Z_End, Thread_Surface(Thread_Z_End) + Clear);
+  Cycle_Rapid(Thread_Z_Start, Thread_Surface(Thread_Z_Start) + Clear);   // back along the taper
+  return 1;
+}
 
+/** @brief Works out the thread depth for the selected thread, straight or pipe */
+void Auto_Thread_Depth() {
+  if (Thread_Taper == 1) {in_Thread_Depth = .8 / Pipe_TPI();}                    // NPT, truncated 60 degree form
+  else if (Thread_Taper == 2) {mm_Thread_Depth = .640327 * 25.4 / Pipe_TPI();}   // BSPT, 55 degree Whitworth form
+  else if (Thread_Mode == 0) {in_Minor_Diameter();}
+  else {mm_Minor_Diameter();}
+}
+
+/** @brief TPI of the selected pipe size */
+double Pipe_TPI() {
+  if (Thread_Taper == 2) {return BSPT_TPI[Pipe_Array_Pos];}
+  return NPT_TPI[Pipe_Array_Pos];
+}
+
+/** @brief Fills the units, small end OD and thread length in from the table when the pipe thread is changed */
+void Pipe_Select() {
+  if (Thread_Taper == 1) {
+    Thread_Mode = 0;
+    in_Outside_Diameter = NPT_E0[Pipe_Array_Pos] + .8 / NPT_TPI[Pipe_Array_Pos];
+    in_length_of_cut = NPT_L2[Pipe_Array_Pos];
+  }
+  if (Thread_Taper == 2) {
+    Thread_Mode = 1;
+    mm_Outside_Diameter = BSPT_Gauge_Dia[Pipe_Array_Pos] - BSPT_Gauge_Length[Pipe_Array_Pos] / 16;
+    mm_length_of_cut = BSPT_Length[Pipe_Array_Pos];
+  }
 }
 
 void mm_Minor_Diameter() {
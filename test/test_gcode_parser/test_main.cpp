@@ -0,0 +1,83 @@
+/*
+  GCode_Parser.h on the host: the words of each line come out right, bad lines get the right error, and the parse
+  rate on a short turning program is printed in lines/sec.  The rate is the host's, not the Teensy's, use it to
+  compare one parser change against another.
+
+  pio test -e native -f test_gcode_parser
+*/
+#include <unity.h>
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include "GCode_Parser.h"
+
+const int Bench_Lines = 13;
+const char *Bench_Program[Bench_Lines] = {
+  "G20 G18 G90 G95", "G8", "(bench program)", "G0 X0.5 Z0.1", "G1 Z-1.0 F0.004", "G1 X0.55",
+  "G2 X0.6 Z-1.05 I0 K-0.05", "G3 X0.7 Z-1.15 I0.1 K0", "G1 X0.75 Z-1.25 ; chamfer", "G0 X0.8",
+  "G0 Z0.1", "G76 P0.05 Z-0.6 I-0.02 J0.005 K0.03 R1.5 H1", "M30"
+};
+const int Bench_Passes = 20000;
+
+GCode_Block Block;
+
+void setUp() {}
+void tearDown() {}
+
+void test_words() {
+  TEST_ASSERT_EQUAL_INT(GCode_OK, GCode_Parse_Line("n10 g1 z-1.25 x +.5 F0.004 (feed) ; rest", &Block));
+  TEST_ASSERT_EQUAL_INT(1, Block.G_Count);
+  TEST_ASSERT_EQUAL_INT(10, Block.G[0]);
+  TEST_ASSERT_EQUAL_INT(-1, Block.M);
+  TEST_ASSERT_TRUE(GCode_Has(&Block, 'Z') && GCode_Has(&Block, 'X') && GCode_Has(&Block, 'F'));
+  TEST_ASSERT_FALSE(GCode_Has(&Block, 'N'));                    // line numbers are skipped
+  TEST_ASSERT_TRUE(fabs(Block.Value['Z' - 'A'] + 1.25) < 1e-12);
+  TEST_ASSERT_TRUE(fabs(Block.Value['X' - 'A'] - .5) < 1e-12);
+  TEST_ASSERT_TRUE(fabs(Block.Value['F' - 'A'] - .004) < 1e-12);
+
+  TEST_ASSERT_EQUAL_INT(GCode_OK, GCode_Parse_Line("G92.1 G 76 M3", &Block));
+  TEST_ASSERT_EQUAL_INT(921, Block.G[0]);
+  TEST_ASSERT_EQUAL_INT(760, Block.G[1]);
+  TEST_ASSERT_EQUAL_INT(3, Block.M);
+}
+
+void test_errors() {
+  TEST_ASSERT_EQUAL_INT(GCode_Empty, GCode_Parse_Line("", &Block));
+  TEST_ASSERT_EQUAL_INT(GCode_Empty, GCode_Parse_Line("  (just a comment) ; and another", &Block));
+  TEST_ASSERT_EQUAL_INT(GCode_Empty, GCode_Parse_Line("N20", &Block));
+  TEST_ASSERT_EQUAL_INT(GCode_Bad_Word, GCode_Parse_Line("G1 Z1 #5", &Block));
+  TEST_ASSERT_EQUAL_INT(GCode_Bad_Number, GCode_Parse_Line("G1 Z", &Block));
+  TEST_ASSERT_EQUAL_INT(GCode_Bad_Number, GCode_Parse_Line("G1 X-.", &Block));
+  TEST_ASSERT_EQUAL_INT(GCode_Bad_Comment, GCode_Parse_Line("G1 (open", &Block));
+  TEST_ASSERT_EQUAL_INT(GCode_Repeated, GCode_Parse_Line("G1 Z1 Z2", &Block));
+  TEST_ASSERT_EQUAL_INT(GCode_Repeated, GCode_Parse_Line("M3 M5", &Block));
+  TEST_ASSERT_EQUAL_INT(GCode_Repeated, GCode_Parse_Line("G0 G1 G2 G3 G4", &Block));
+}
+
+void test_parse_rate() {
+  for (int line = 0; line < Bench_Lines; line++) {
+    int Want = (line == 2) ? GCode_Empty : GCode_OK;
+    TEST_ASSERT_EQUAL_INT_MESSAGE(Want, GCode_Parse_Line(Bench_Program[line], &Block), Bench_Program[line]);
+  }
+  long Words = 0;
+  auto Start = std::chrono::steady_clock::now();
+  for (int pass = 0; pass < Bench_Passes; pass++) {
+    for (int line = 0; line < Bench_Lines; line++) {
+      GCode_Parse_Line(Bench_Program[line], &Block);
+      Words += Block.G_Count;                                   // keeps the loop from being optimised away
+    }
+  }
+  double Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+  TEST_ASSERT_TRUE(Words > 0);
+  char Line[80];
+  snprintf(Line, sizeof(Line), "gcode_lines %ld  parse_lines_sec %.0f", (long)Bench_Lines * Bench_Passes, Bench_Lines * Bench_Passes / Seconds);
+  TEST_MESSAGE(Line);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_words);
+  RUN_TEST(test_errors);
+  RUN_TEST(test_parse_rate);
+  return UNITY_END();
+}
@@ -0,0 +1,117 @@
+/*
+  Lead error sweep.  Walks every TPI_Array and Pitch_Array entry through the ratio the thread modes lock the
+  leadscrew to (Sync_Ratio.h) and runs it count by count through the same integer accumulator Sync_Step() uses,
+  forward and back again.  The leadscrew has to stay within a step of the ideal spindle locked position the whole
+  way, at any spindle counts per rev, so there is no lead error to build up over the length of a thread.
+
+  The fastest spindle speed each entry can be cut at with the default machine settings in Header.h is printed, one
+  line per entry, compare it with Thread_Max_RPM on the lathe.
+
+  pio test -e native -f test_lead_sweep
+*/
+#include <unity.h>
+#include <stdio.h>
+#include "Sync_Ratio.h"
+
+//----Machine Defaults, from Header.h----//
+  const long long Steps_Per_Inch = 8 * 6400;                  // LeadScrew_TPI * LeadSPR
+  const long long Default_CPR = 3416;                         // SpindleCPR
+  const double Lead_Speed = 600.0 * 6400 / 60;                // LeadSpeed, MaxLeadRPM in steps/sec
+
+  const long long Sweep_CPR[] = {3416, 4096, 2000, 1000, 600};
+  const int Sweep_Revs = 40;                                  // spindle revs run each way
+
+void setUp() {}
+void tearDown() {}
+
+/** @brief Nominal lead of a table entry in inch per spindle rev, worked out in long double from the printed size
+    @param metric  : 0 = TPI_Array, 1 = Pitch_Array
+    @param entry   : table position
+*/
+long double Nominal_Lead(int metric, int entry) {
+  if (metric == 0) {return 1.0L / TPI_Array[entry];}
+  return llroundl(Pitch_Array[entry] * 1000.0L) / 1000.0L / 25.4L;   // the table is float, every pitch has at most 2 decimals
+}
+
+/** @brief The ratio Thread() and Thread_Plan() lock to for a table entry */
+void Entry_Ratio(int metric, int entry, long long cpr, long long *num, long long *den) {
+  if (metric == 0) {Sync_TPI_Ratio(TPI_Array[entry], Steps_Per_Inch, cpr, num, den);}
+  else {Sync_Lead_Ratio(Pitch_Array[entry], 1, Steps_Per_Inch, cpr, num, den);}
+}
+
+/**
+  @brief Runs a lock Sync_Step() style, one spindle count at a time out for Sweep_Revs and back to the start
+  @return worst distance in steps between the leadscrew and the ideal position for the spindle count
+*/
+long double Run_Lock(long long num, long long den, long long cpr, long double lead) {
+  long double Ideal_Per_Count = lead * Steps_Per_Inch / cpr;
+  long long Acc = 0;
+  long long Steps = 0;
+  long double Worst = 0;
+  long long Counts = Sweep_Revs * cpr;
+  for (long long Count = 1; Count <= 2 * Counts; Count++) {
+    long long Spindle = (Count <= Counts) ? Count : 2 * Counts - Count;
+    Acc += (Count <= Counts) ? num : -num;
+    while (Acc >= den) {Acc -= den; Steps++;}
+    while (Acc < 0) {Acc += den; Steps--;}
+    long double Error = fabsl(Steps - Spindle * Ideal_Per_Count);
+    if (Error > Worst) {Worst = Error;}
+  }
+  TEST_ASSERT_EQUAL_INT64(0, Steps);                          // back on the start step with the spindle back at its start
+  TEST_ASSERT_EQUAL_INT64(0, Acc);
+  return Worst;
+}
+
+/** @brief Sweeps one table at every Sweep_CPR */
+void Sweep_Table(int metric) {
+  int Entries = (metric == 0) ? TPI_Array_Size : Pitch_Array_Size;
+  for (int entry = 0; entry < Entries; entry++) {
+    for (unsigned c = 0; c < sizeof(Sweep_CPR) / sizeof(Sweep_CPR[0]); c++) {
+      long long Num, Den;
+      Entry_Ratio(metric, entry, Sweep_CPR[c], &Num, &Den);
+      long double Worst = Run_Lock(Num, Den, Sweep_CPR[c], Nominal_Lead(metric, entry));
+      char Line[80];
+      snprintf(Line, sizeof(Line), "%s entry %d at %lld CPR is %.3Lf steps off", metric ? "Pitch" : "TPI", entry, Sweep_CPR[c], Worst);
+      TEST_ASSERT_TRUE_MESSAGE(Worst < 1.0L, Line);
+    }
+  }
+}
+
+void test_tpi_table_is_exact() {Sweep_Table(0);}
+
+void test_pitch_table_is_exact() {Sweep_Table(1);}
+
+void test_lead_ratio_decimals() {
+  long long Num, Den;
+  Sync_Lead_Ratio(.004, 0, Steps_Per_Inch, Default_CPR, &Num, &Den);          // a feed, inch per rev
+  TEST_ASSERT_EQUAL_INT64(4000 * Steps_Per_Inch, Num);
+  TEST_ASSERT_EQUAL_INT64(1000000LL * Default_CPR, Den);
+  Sync_Lead_Ratio(.12345, 1, Steps_Per_Inch, Default_CPR, &Num, &Den);        // 5 decimals of mm still exact
+  TEST_ASSERT_EQUAL_INT64(12345 * Steps_Per_Inch, Num);
+  TEST_ASSERT_EQUAL_INT64(2540000LL * Default_CPR, Den);
+}
+
+void test_max_rpm() {
+  char Line[80];
+  for (int metric = 0; metric <= 1; metric++) {
+    int Entries = (metric == 0) ? TPI_Array_Size : Pitch_Array_Size;
+    for (int entry = 0; entry < Entries; entry++) {
+      long long Num, Den;
+      Entry_Ratio(metric, entry, Default_CPR, &Num, &Den);
+      double Max_RPM = Lead_Speed * 60 * Den / ((double)Num * Default_CPR);     // same sum as Thread_Max_RPM
+      if (metric == 0) {snprintf(Line, sizeof(Line), "TPI %d  max %.0f RPM", TPI_Array[entry], Max_RPM);}
+      else {snprintf(Line, sizeof(Line), "Pitch %.2f  max %.0f RPM", Pitch_Array[entry], Max_RPM);}
+      TEST_MESSAGE(Line);
+      if (metric == 0 && TPI_Array[entry] == 8) {TEST_ASSERT_TRUE(fabs(Max_RPM - 600) < 1e-9);}   // 8 TPI on an 8 TPI leadscrew turns it 1:1
+    }
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_tpi_table_is_exact);
+  RUN_TEST(test_pitch_table_is_exact);
+  RUN_TEST(test_lead_ratio_decimals);
+  RUN_TEST(test_max_rpm);
+  return UNITY_END();
+}
@@ -0,0 +1,97 @@
+/*
+  Polygon RPM simulation.  Builds profiles with Polygon_Profile.h at the default machine settings in Header.h and
+  runs the cross slide after them tick by tick the way Sync_Step() does, step credit earned at Cross_Speed and one
+  step a tick at most, with the spindle turning at a steady speed.  The table moves in whole counts, so near the
+  corners of a polygon the target jumps several steps at a time and the cross slide is always up to one count's
+  jump behind.  Below the Polygon_Profile_Max_RPM the lathe shows it has to stay within that, above it it has to
+  fall further behind, so the top speed is neither optimistic nor needlessly slow.  The error at each speed is
+  printed against the default following error limit.
+
+  pio test -e native -f test_polygon_rpm
+*/
+#include <unity.h>
+#include <stdio.h>
+#include "Polygon_Profile.h"
+
+//----Machine Defaults, from Header.h----//
+  const long CPR = 3416;                                      // SpindleCPR
+  const double Steps_Per_Inch = 8 * 6400;                     // Steps_per_Move(1) in inch, LeadScrew_TPI * LeadSPR
+  const double Cross_Speed = 250.0 * 6400 / 60;               // MaxCrossRPM * CrossSPR / 60
+  const double Step_Tick_US = 5;
+  const long Step_Credit = 1000000;
+  const long Follow_Limit = .003 * Steps_Per_Inch;            // in_Follow_Limit
+
+  const int Sim_Revs = 3;
+
+long Table[CPR];
+
+void setUp() {}
+void tearDown() {}
+
+/**
+  @brief Runs the cross slide after the table for Sim_Revs revs of the spindle from angle zero
+  @param rpm  : spindle speed
+  @return worst distance in steps between the cross slide and the profile
+*/
+long Follow_Profile(double rpm) {
+  double Counts_Per_Tick = rpm / 60 * CPR * Step_Tick_US / 1000000;
+  long Rate = Cross_Speed * Step_Tick_US;                    // Sync_X_Rate
+  long Credit = 0;
+  long Pos = Table[0];
+  long Worst = 0;
+  long Ticks = Sim_Revs * CPR / Counts_Per_Tick;
+  for (long Tick = 0; Tick < Ticks; Tick++) {
+    long Count = (long)(Tick * Counts_Per_Tick);
+    long Target = Table[Count % CPR];
+    if (Credit < Step_Credit) {Credit += Rate;}
+    if (Pos != Target && Credit >= Step_Credit) {Pos += (Target > Pos) ? 1 : -1; Credit -= Step_Credit;}
+    long Error = labs(Target - Pos);
+    if (Error > Worst) {Worst = Error;}
+  }
+  return Worst;
+}
+
+/** @brief Checks a shape tracks at 90% of its top speed and falls behind at 130% */
+void Check_Shape(const char *Name, int Type, int Sides, double Size, double Offset) {
+  TEST_ASSERT_EQUAL_INT(1, Polygon_Profile(Type, Sides, Size / 2 * Steps_Per_Inch, Offset * Steps_Per_Inch, CPR, Table));
+  double Max_RPM = Polygon_Profile_Max_RPM(Table, CPR, Cross_Speed);
+  long Jump = 0;                                              // most the target moves from one count to the next
+  for (long Count = 0; Count < CPR; Count++) {
+    long Rise = labs(Table[(Count + 1) % CPR] - Table[Count]);
+    if (Rise > Jump) {Jump = Rise;}
+  }
+  long Under = Follow_Profile(Max_RPM * .9);
+  long Over = Follow_Profile(Max_RPM * 1.3);
+  char Line[120];
+  snprintf(Line, sizeof(Line), "%s  max %.0f RPM  error %ld steps at 90%%, %ld at 130%%, jump %ld, follow limit %ld",
+           Name, Max_RPM, Under, Over, Jump, Follow_Limit);
+  TEST_MESSAGE(Line);
+  TEST_ASSERT_TRUE_MESSAGE(Under <= Jump + 1, Line);
+  TEST_ASSERT_TRUE_MESSAGE(Over > 2 * Jump + 1, Line);
+}
+
+void test_square() {Check_Shape("square .5", 0, 4, .5, 0);}
+
+void test_hexagon() {Check_Shape("hex .5", 0, 6, .5, 0);}
+
+void test_twelve_sides() {Check_Shape("12 sides 1.0", 0, 12, 1.0, 0);}
+
+void test_eccentric() {Check_Shape("eccentric .02 on .5", 1, 0, .5, .02);}
+
+void test_no_shape() {
+  TEST_ASSERT_EQUAL_INT(0, Polygon_Profile(0, 2, 1000, 0, CPR, Table));     // too few sides
+  TEST_ASSERT_EQUAL_INT(0, Polygon_Profile(1, 0, 1000, 1000, CPR, Table));  // offset as big as the radius
+  TEST_ASSERT_EQUAL_INT(0, Polygon_Profile(0, 4, 0, 0, CPR, Table));
+  TEST_ASSERT_EQUAL_INT(1, Polygon_Profile(1, 0, 1000, 0, CPR, Table));     // no offset is round
+  TEST_ASSERT_TRUE(Polygon_Profile_Max_RPM(Table, CPR, Cross_Speed) == 9999);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_square);
+  RUN_TEST(test_hexagon);
+  RUN_TEST(test_twelve_sides);
+  RUN_TEST(test_eccentric);
+  RUN_TEST(test_no_shape);
+  return UNITY_END();
+}
@@ -0,0 +1,121 @@
+/*
+  Protocol_Codec.h on the host: every frame the encoder builds comes back out of the byte at a time decoder
+  unchanged, and a damaged or oversized frame is dropped without losing the frame after it.
+
+  pio test -e native -f test_protocol_codec
+*/
+#include <unity.h>
+#include "Protocol_Codec.h"
+
+Protocol_Decoder Decoder;
+
+void setUp() {Protocol_Decoder_Reset(&Decoder);}
+void tearDown() {}
+
+/** @brief Feeds an encoded frame one byte at a time, the decoder has to hold off until the 0x00
+    @return what the decoder said on the last byte
+*/
+int Feed(const uint8_t *Encoded, int Length) {
+  for (int i = 0; i < Length - 1; i++) {
+    int Result = Protocol_Decode_Byte(&Decoder, Encoded[i]);
+    if (Result != 0) {return -100 - i;}                       // spoke before the end of the frame
+  }
+  return Protocol_Decode_Byte(&Decoder, Encoded[Length - 1]);
+}
+
+/** @brief Encodes a payload, checks the encoding holds no zero but the last and decodes it back to the same frame */
+void Roundtrip(uint8_t Type, uint8_t Seq, const uint8_t *Payload, int Size) {
+  uint8_t Encoded[Protocol_Max_Encoded];
+  int Length = Protocol_Encode(Type, Seq, Payload, Size, Encoded);
+  TEST_ASSERT_TRUE(Length > 0 && Length <= Protocol_Max_Encoded);
+  for (int i = 0; i < Length - 1; i++) {TEST_ASSERT_TRUE(Encoded[i] != 0);}
+  TEST_ASSERT_EQUAL_INT(0, Encoded[Length - 1]);
+  TEST_ASSERT_EQUAL_INT(Size + 2, Feed(Encoded, Length));
+  TEST_ASSERT_EQUAL_INT(Type, Decoder.Frame[0]);
+  TEST_ASSERT_EQUAL_INT(Seq, Decoder.Frame[1]);
+  if (Size > 0) {TEST_ASSERT_EQUAL_UINT8_ARRAY(Payload, Decoder.Frame + 2, Size);}
+}
+
+void test_empty_and_short_payloads() {
+  uint8_t Payload[5] = {0x10, 0x20, 0x30, 0x40, 0x50};
+  Roundtrip(Msg_Ping, 0, Payload, 0);
+  Roundtrip(Msg_Get_Setting, 1, Payload, 1);
+  Roundtrip(Msg_Set_Setting, 255, Payload, 5);
+}
+
+void test_zero_runs() {
+  uint8_t Payload[Protocol_Max_Payload];
+  memset(Payload, 0, sizeof(Payload));
+  for (int Size = 0; Size <= Protocol_Max_Payload; Size++) {Roundtrip(0, 0, Payload, Size);}   // all zeros, type and seq too
+  for (int i = 0; i < Protocol_Max_Payload; i++) {Payload[i] = (i % 7 < 3) ? 0 : i;}           // runs of zeros between data
+  for (int Size = 0; Size <= Protocol_Max_Payload; Size++) {Roundtrip(Msg_GCode, Size, Payload, Size);}
+}
+
+void test_max_length_frames() {
+  uint8_t Payload[Protocol_Max_Payload + 1];
+  for (int i = 0; i <= Protocol_Max_Payload; i++) {Payload[i] = 1 + i % 255;}                   // no zeros, the longest COBS block
+  Roundtrip(Msg_Motion, 7, Payload, Protocol_Max_Payload);
+  Payload[Protocol_Max_Payload / 2] = 0;
+  Roundtrip(Msg_Motion, 8, Payload, Protocol_Max_Payload);
+
+  uint8_t Encoded[Protocol_Max_Encoded + 16];
+  TEST_ASSERT_EQUAL_INT(0, Protocol_Encode(Msg_Motion, 9, Payload, Protocol_Max_Payload + 1, Encoded));   // too long to send
+}
+
+void test_oversized_frame_is_dropped() {
+  for (int i = 0; i < Protocol_Max_Frame + 20; i++) {TEST_ASSERT_EQUAL_INT(0, Protocol_Decode_Byte(&Decoder, (i % 200 == 0) ? 200 : 0x55));}
+  TEST_ASSERT_EQUAL_INT(-1, Protocol_Decode_Byte(&Decoder, 0));
+  uint8_t Payload[2] = {3, 4};
+  Roundtrip(Msg_Ping, 1, Payload, 2);                          // starts clean on the next frame
+}
+
+void test_corrupt_crc() {
+  uint8_t Payload[12] = {1, 2, 0, 4, 5, 0, 0, 8, 9, 10, 0, 12};
+  uint8_t Encoded[Protocol_Max_Encoded];
+  int Length = Protocol_Encode(Msg_Set_Setting, 42, Payload, 12, Encoded);
+  int Next_Code = 0;
+  for (int i = 0; i < Length - 1; i++) {
+    if (i == Next_Code) {Next_Code = i + Encoded[i]; continue;}   // a code byte changes the framing, the data bytes are what the CRC covers
+    uint8_t Bad[Protocol_Max_Encoded];
+    memcpy(Bad, Encoded, Length);
+    Bad[i] ^= (Bad[i] == 0x80) ? 0x01 : 0x80;                    // never makes a zero
+    TEST_ASSERT_EQUAL_INT(-1, Feed(Bad, Length));
+    TEST_ASSERT_EQUAL_INT(12 + 2, Feed(Encoded, Length));        // the good frame after it still gets through
+  }
+}
+
+void test_truncated_and_idle() {
+  TEST_ASSERT_EQUAL_INT(0, Protocol_Decode_Byte(&Decoder, 0));  // idle line
+  TEST_ASSERT_EQUAL_INT(0, Protocol_Decode_Byte(&Decoder, 0));
+  uint8_t Payload[4] = {9, 8, 7, 6};
+  uint8_t Encoded[Protocol_Max_Encoded];
+  int Length = Protocol_Encode(Msg_Ping, 3, Payload, 4, Encoded);
+  for (int Cut = 1; Cut < Length - 1; Cut++) {                  // the rest of the frame never came
+    for (int i = 0; i < Cut; i++) {Protocol_Decode_Byte(&Decoder, Encoded[i]);}
+    TEST_ASSERT_EQUAL_INT(-1, Protocol_Decode_Byte(&Decoder, 0));
+  }
+  TEST_ASSERT_EQUAL_INT(4 + 2, Feed(Encoded, Length));
+}
+
+void test_payload_helpers() {
+  uint8_t At[4];
+  Protocol_Put_U16(At, 0xBEEF);
+  TEST_ASSERT_EQUAL_INT(0xBEEF, Protocol_Get_U16(At));
+  Protocol_Put_U32(At, 0xDEADBEEF);
+  TEST_ASSERT_TRUE(Protocol_Get_U32(At) == 0xDEADBEEF);
+  TEST_ASSERT_EQUAL_INT(0xEF, At[0]);                           // little endian
+  Protocol_Put_Float(At, -12.375f);
+  TEST_ASSERT_TRUE(Protocol_Get_Float(At) == -12.375f);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_empty_and_short_payloads);
+  RUN_TEST(test_zero_runs);
+  RUN_TEST(test_max_length_frames);
+  RUN_TEST(test_oversized_frame_is_dropped);
+  RUN_TEST(test_corrupt_crc);
+  RUN_TEST(test_truncated_and_idle);
+  RUN_TEST(test_payload_helpers);
+  return UNITY_END();
+}
@@ -0,0 +1,305 @@
+/*
+  Protocol.h over a pseudo-terminal: the host writes encoded frames into the master side, the firmware's
+  Protocol_Update() reads them off the slave side through a stand-in for Serial, and every answer is read back
+  and decoded like a PC program would.  Covers dispatch, the framing of the replies, a frame with a bad CRC and
+  a frame that arrives in two reads.
+
+  pio test -e native -f test_protocol_loopback
+*/
+#include <unity.h>
+#include <fcntl.h>
+#include <math.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "Protocol_Codec.h"
+#include "Sync_Ratio.h"
+
+//----Stand-ins for the firmware the dispatcher touches----//
+  int Lathe_Fd = -1;                                    // slave side of the pty, the lathe's USB serial
+  int Host_Fd = -1;                                     // master side, the PC
+
+  struct Lathe_Serial {
+    int available() {int Count = 0; ioctl(Lathe_Fd, FIONREAD, &Count); return Count;}
+    int read() {uint8_t Data; return (::read(Lathe_Fd, &Data, 1) == 1) ? Data : -1;}
+    int availableForWrite() {return Protocol_Max_Encoded;}
+    void write(const uint8_t *Data, int Length) {if (::write(Lathe_Fd, Data, Length) != Length) {abort();}}
+  };
+  Lathe_Serial Serial;
+
+  struct Axis_Stub {
+    long Position = 0;
+    int Stops = 0;
+    long currentPosition() {return Position;}
+    void stop() {Stops++;}
+  };
+  Axis_Stub LeadScrew;
+  Axis_Stub CrossSlide;
+
+  struct Encoder_Stub {
+    void setEncoderPosition(int) {}
+  };
+  Encoder_Stub Enc1;
+
+  unsigned long millis() {
+    timespec Now;
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return Now.tv_sec * 1000UL + Now.tv_nsec / 1000000;
+  }
+
+  struct Protocol_Setting {
+    double *Real;
+    int *Whole;
+    double Min;
+    double Max;
+  };
+  Protocol_Setting Protocol_Settings[Setting_Count];
+  double In_FeedRate = .001;
+  double Setting_Other = 0;                             // every other real setting, only the ranges matter here
+  int Metric = 0;
+  int Whole_Other = 0;
+
+  double SpindleRPM = 0;
+  int Mode_Array_Pos = 0;
+  int Measure_Array_Pos = 0;
+  int Mode = 0;
+  int submenu = 0;
+  int status = -1;
+  int TPI_Array_Pos = 17;
+  int Pitch_Array_Pos = 5;
+  double TPI = 0;
+  double Pitch = 0;
+  int Build_ZY = 1;
+  int Planner_Hold = 1;
+  long Follow_Peak = 0;
+  int Follow_Hold = 0;
+  uint16_t Lead_Slips = 0;
+  uint16_t Cross_Slips = 0;
+  long GCode_Lines = 0;
+  int GCode_Error = 0;
+  long GCode_Error_Line = 0;
+  int GCode_Received = 0;
+  int Cycle_Stops = 0;
+
+  Protocol_Decoder Protocol_Rx;
+  const int Protocol_Rx_Budget = 64;
+  uint8_t Protocol_Streams = 0;
+  uint16_t Protocol_Status_Period = 100;
+  unsigned long Protocol_Status_Time = 0;
+  uint8_t Protocol_Tx_Seq = 0;
+
+  void Pipe_Select() {}
+  void Output_Configure() {}
+  void Telemetry_Reset() {}
+  void Planner_Clear() {}
+  void GCode_Reset() {}
+  int Cycle_Mode() {return Mode_Array_Pos == 3;}
+  void Cycle_Stop() {Cycle_Stops++;}
+  int GCode_Receive(const uint8_t *, int Size) {GCode_Received += Size; return 1;}
+  int GCode_Text_Free() {return 512 - GCode_Received;}
+
+  void Protocol_Update();
+  void Protocol_Dispatch(const uint8_t *Frame, int Length);
+  void Protocol_Setting_Changed(uint8_t ID);
+  void Protocol_Send(uint8_t Type, uint8_t Seq, const uint8_t *Payload, int Size);
+  void Protocol_Ack(uint8_t Type, uint8_t Seq);
+  void Protocol_Nak(uint8_t Type, uint8_t Seq, uint8_t Reason);
+  void Protocol_Send_Setting(uint8_t ID, uint8_t Seq);
+  void Protocol_Send_Status();
+  void Protocol_Send_GCode_Ack(uint8_t Seq);
+
+#include "../../src/Protocol.h"
+
+//----Host side----//
+  Protocol_Decoder Host_Rx;
+
+/** @brief Runs the lathe side until every byte the host sent has been through Protocol_Update() */
+void Lathe_Service() {
+  pollfd Wait = {Lathe_Fd, POLLIN, 0};
+  poll(&Wait, 1, 200);                                  // pty data shows up on the other side a moment later
+  for (int Pass = 0; Pass < 100 && Serial.available() > 0; Pass++) {
+    Protocol_Update();
+    poll(&Wait, 1, 5);
+  }
+}
+
+/** @brief Sends bytes from the host and lets the lathe act on them */
+void Host_Write(const uint8_t *Data, int Length) {
+  TEST_ASSERT_EQUAL_INT(Length, write(Host_Fd, Data, Length));
+  Lathe_Service();
+}
+
+/** @brief Encodes and sends one frame from the host */
+void Host_Send(uint8_t Type, uint8_t Seq, const uint8_t *Payload, int Size) {
+  uint8_t Encoded[Protocol_Max_Encoded];
+  int Length = Protocol_Encode(Type, Seq, Payload, Size, Encoded);
+  Host_Write(Encoded, Length);
+}
+
+/**
+  @brief Reads the next answer on the host side, checking its framing on the way: no 0x00 but the terminator
+         and a good CRC
+  @return frame length as Protocol_Decode_Byte() gives it, 0 when nothing came within Wait_ms
+*/
+int Host_Read(int Wait_ms) {
+  pollfd Wait = {Host_Fd, POLLIN, 0};
+  int Raw = 0;
+  while (poll(&Wait, 1, Wait_ms) > 0) {
+    uint8_t Data;
+    if (read(Host_Fd, &Data, 1) != 1) {break;}
+    Raw++;
+    int Length = Protocol_Decode_Byte(&Host_Rx, Data);
+    TEST_ASSERT_TRUE_MESSAGE(Length >= 0, "reply failed its CRC or framing");
+    if (Length > 0) {return Length;}
+  }
+  TEST_ASSERT_EQUAL_INT_MESSAGE(0, Raw, "reply cut short");
+  return 0;
+}
+
+/** @brief Reads the next answer and checks its type and sequence number */
+void Expect(uint8_t Type, uint8_t Seq, int Size) {
+  TEST_ASSERT_EQUAL_INT(Size + 2, Host_Read(500));
+  TEST_ASSERT_EQUAL_INT(Type, Host_Rx.Frame[0]);
+  TEST_ASSERT_EQUAL_INT(Seq, Host_Rx.Frame[1]);
+}
+
+void Expect_Nothing() {
+  TEST_ASSERT_EQUAL_INT(0, Host_Read(50));
+}
+
+void setUp() {
+  Host_Fd = posix_openpt(O_RDWR | O_NOCTTY);
+  TEST_ASSERT_TRUE(Host_Fd >= 0 && grantpt(Host_Fd) == 0 && unlockpt(Host_Fd) == 0);
+  Lathe_Fd = open(ptsname(Host_Fd), O_RDWR | O_NOCTTY | O_NONBLOCK);
+  TEST_ASSERT_TRUE(Lathe_Fd >= 0);
+  termios Raw;                                          // no line discipline, 0x00, CR and ^C are just bytes
+  tcgetattr(Lathe_Fd, &Raw);
+  cfmakeraw(&Raw);
+  tcsetattr(Lathe_Fd, TCSANOW, &Raw);
+
+  for (int ID = 0; ID < Setting_Count; ID++) {Protocol_Settings[ID] = {&Setting_Other, NULL, 0, 1000};}
+  Protocol_Settings[Setting_In_FeedRate] = {&In_FeedRate, NULL, .001, 1};
+  Protocol_Settings[Setting_Metric] = {NULL, &Metric, 0, 1};
+  Protocol_Settings[Setting_Mode_Array_Pos] = {NULL, &Mode_Array_Pos, 0, 15};
+  In_FeedRate = .001;
+  Metric = 0;
+  Mode_Array_Pos = 0;
+  SpindleRPM = 0;
+  status = -1;
+  Protocol_Streams = 0;
+  Protocol_Decoder_Reset(&Protocol_Rx);
+  Protocol_Decoder_Reset(&Host_Rx);
+}
+
+void tearDown() {
+  close(Lathe_Fd);
+  close(Host_Fd);
+}
+
+void test_ping_is_acked() {
+  Host_Send(Msg_Ping, 7, NULL, 0);
+  Expect(Msg_Ack, 7, 1);
+  TEST_ASSERT_EQUAL_INT(Msg_Ping, Host_Rx.Frame[2]);
+  Expect_Nothing();
+}
+
+void test_settings_are_written_and_read_back() {
+  uint8_t Payload[5] = {Setting_In_FeedRate};
+  Protocol_Put_Float(Payload + 1, .005f);
+  Host_Send(Msg_Set_Setting, 1, Payload, 5);
+  Expect(Msg_Setting, 1, 5);
+  TEST_ASSERT_EQUAL_INT(Setting_In_FeedRate, Host_Rx.Frame[2]);
+  TEST_ASSERT_TRUE(fabs(Protocol_Get_Float(Host_Rx.Frame + 3) - .005) < 1e-6);
+  TEST_ASSERT_TRUE(fabs(In_FeedRate - .005) < 1e-6);
+
+  Payload[0] = Setting_Metric;
+  Protocol_Put_Float(Payload + 1, 1);
+  Host_Send(Msg_Set_Setting, 2, Payload, 5);
+  Expect(Msg_Setting, 2, 5);
+  TEST_ASSERT_EQUAL_INT(1, Metric);
+  TEST_ASSERT_EQUAL_INT(1, Measure_Array_Pos);                  // Protocol_Setting_Changed() ran
+
+  uint8_t ID = Setting_In_FeedRate;
+  Host_Send(Msg_Get_Setting, 3, &ID, 1);
+  Expect(Msg_Setting, 3, 5);
+  TEST_ASSERT_TRUE(fabs(Protocol_Get_Float(Host_Rx.Frame + 3) - .005) < 1e-6);
+}
+
+void test_bad_requests_are_naked() {
+  uint8_t Payload[5] = {Setting_In_FeedRate};
+  Protocol_Put_Float(Payload + 1, 5);                           // out of range
+  Host_Send(Msg_Set_Setting, 4, Payload, 5);
+  Expect(Msg_Nak, 4, 2);
+  TEST_ASSERT_EQUAL_INT(Msg_Set_Setting, Host_Rx.Frame[2]);
+  TEST_ASSERT_EQUAL_INT(Nak_Setting, Host_Rx.Frame[3]);
+  Protocol_Put_Float(Payload + 1, NAN);
+  Host_Send(Msg_Set_Setting, 5, Payload, 5);
+  Expect(Msg_Nak, 5, 2);
+  TEST_ASSERT_EQUAL_INT(Nak_Setting, Host_Rx.Frame[3]);
+  TEST_ASSERT_TRUE(fabs(In_FeedRate - .001) < 1e-9);
+
+  Host_Send(Msg_Get_Setting, 6, NULL, 0);
+  Expect(Msg_Nak, 6, 2);
+  TEST_ASSERT_EQUAL_INT(Nak_Length, Host_Rx.Frame[3]);
+
+  Host_Send(0x7F, 8, NULL, 0);
+  Expect(Msg_Nak, 8, 2);
+  TEST_ASSERT_EQUAL_INT(Nak_Unknown, Host_Rx.Frame[3]);
+
+  Host_Send(Msg_Stop_Cycle, 9, NULL, 0);                        // Feed mode has no cycle to stop
+  Expect(Msg_Nak, 9, 2);
+  TEST_ASSERT_EQUAL_INT(Nak_State, Host_Rx.Frame[3]);
+
+  SpindleRPM = 500;                                             // only feed rates change with the spindle turning
+  Payload[0] = Setting_Metric;
+  Protocol_Put_Float(Payload + 1, 1);
+  Host_Send(Msg_Set_Setting, 10, Payload, 5);
+  Expect(Msg_Nak, 10, 2);
+  TEST_ASSERT_EQUAL_INT(Nak_Busy, Host_Rx.Frame[3]);
+  TEST_ASSERT_EQUAL_INT(0, Metric);
+}
+
+void test_corrupt_crc_is_dropped() {
+  uint8_t Both[2 * Protocol_Max_Encoded];
+  uint8_t Payload[2] = {0x22, 0x33};
+  int Length = Protocol_Encode(Msg_Ping, 11, Payload, 2, Both);
+  Both[3] ^= 0x40;                                              // 0x22 -> 0x62, still no zero byte
+  Length += Protocol_Encode(Msg_Ping, 12, NULL, 0, Both + Length);
+  Host_Write(Both, Length);
+  Expect(Msg_Ack, 12, 1);                                       // only the good frame is answered
+  Expect_Nothing();
+}
+
+void test_frame_split_across_reads() {
+  uint8_t Encoded[Protocol_Max_Encoded];
+  uint8_t Payload[5] = {Setting_In_FeedRate};
+  Protocol_Put_Float(Payload + 1, .25f);
+  int Length = Protocol_Encode(Msg_Set_Setting, 13, Payload, 5, Encoded);
+  Host_Write(Encoded, 4);
+  Expect_Nothing();                                             // half a frame is never acted on
+  TEST_ASSERT_TRUE(fabs(In_FeedRate - .001) < 1e-9);
+  Host_Write(Encoded + 4, Length - 4);
+  Expect(Msg_Setting, 13, 5);
+  TEST_ASSERT_TRUE(fabs(In_FeedRate - .25) < 1e-6);
+}
+
+void test_gcode_chunk_is_acked_with_room() {
+  const char *Text = "G0 X1 Z2\n";
+  Host_Send(Msg_GCode, 14, (const uint8_t *)Text, strlen(Text));
+  Expect(Msg_GCode_Ack, 14, 11);
+  TEST_ASSERT_EQUAL_INT(GCode_Text_Free(), Protocol_Get_U16(Host_Rx.Frame + 2));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_ping_is_acked);
+  RUN_TEST(test_settings_are_written_and_read_back);
+  RUN_TEST(test_bad_requests_are_naked);
+  RUN_TEST(test_corrupt_crc_is_dropped);
+  RUN_TEST(test_frame_split_across_reads);
+  RUN_TEST(test_gcode_chunk_is_acked_with_room);
+  return UNITY_END();
+}
@@ -0,0 +1,164 @@
+/*
+  Settings_Store.h on the host, through its file backend: records go round the ring of slots, the newest good one
+  comes back after a restart, a damaged newest record falls back to the one before it, the sequence number can
+  wrap and a record of another version is never loaded.
+
+  pio test -e native -f test_settings_store
+*/
+#include <unity.h>
+#include <stdio.h>
+#include "Settings_Store.h"
+
+/** @brief Forgets what is in memory, like a power cycle, so the next Settings_Load() works only from the store */
+void Restart() {
+  Settings_Slot = -1;
+  Settings_Sequence = 0;
+}
+
+/** @brief A payload told apart from the others by its feed rate */
+Settings_Payload Payload(float Feed) {
+  Settings_Payload Data;
+  memset(&Data, 0, sizeof(Data));
+  Data.In_FeedRate = Feed;
+  Data.Thread_Starts = 1;
+  return Data;
+}
+
+/** @brief Writes a record straight into a slot, for records Settings_Save() would never write */
+void Write_Slot(int Slot, uint8_t Version, uint16_t Sequence, float Feed) {
+  Settings_Record Record;
+  Record.Magic = Settings_Magic;
+  Record.Version = Version;
+  Record.Sequence = Sequence;
+  Record.Data = Payload(Feed);
+  Record.CRC = CRC16((const uint8_t *)&Record, sizeof(Record) - sizeof(Record.CRC));
+  for (unsigned int i = 0; i < sizeof(Record); i++) {Settings_Store_Write(Slot * sizeof(Record) + i, ((const uint8_t *)&Record)[i]);}
+}
+
+void setUp() {
+  Settings_Store_File = "test_settings_store.bin";
+  remove(Settings_Store_File);
+  Restart();
+}
+
+void tearDown() {
+  remove(Settings_Store_File);
+}
+
+void test_empty_store_loads_nothing() {
+  Settings_Payload Data = Payload(7);
+  TEST_ASSERT_FALSE(Settings_Load(&Data));
+  TEST_ASSERT_TRUE(Data.In_FeedRate == 7);                      // left untouched
+  TEST_ASSERT_EQUAL_INT(-1, Settings_Slot);
+}
+
+void test_save_and_load() {
+  Settings_Payload Saved = Payload(.004f);
+  Saved.Metric = 1;
+  Saved.Thread_Pull_Angle = 30;
+  Settings_Save(&Saved);
+  Restart();
+  Settings_Payload Loaded = Payload(0);
+  TEST_ASSERT_TRUE(Settings_Load(&Loaded));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY((const uint8_t *)&Saved, (const uint8_t *)&Loaded, sizeof(Saved));
+  TEST_ASSERT_EQUAL_INT(0, Settings_Slot);
+  TEST_ASSERT_EQUAL_INT(1, Settings_Sequence);
+}
+
+void test_saves_go_round_the_ring() {
+  TEST_ASSERT_TRUE(Settings_Slots > 2);
+  int Saves = 2 * Settings_Slots + 3;
+  for (int i = 0; i < Saves; i++) {
+    Settings_Payload Data = Payload(i);
+    Settings_Save(&Data);
+    TEST_ASSERT_EQUAL_INT(i % Settings_Slots, Settings_Slot);   // each save in the slot after the last
+  }
+  Restart();
+  Settings_Payload Loaded;
+  TEST_ASSERT_TRUE(Settings_Load(&Loaded));
+  TEST_ASSERT_TRUE(Loaded.In_FeedRate == Saves - 1);
+  TEST_ASSERT_EQUAL_INT((Saves - 1) % Settings_Slots, Settings_Slot);
+  TEST_ASSERT_EQUAL_INT(Saves, Settings_Sequence);
+
+  Settings_Payload Next = Payload(100);                         // carries on round the ring after a restart
+  Settings_Save(&Next);
+  TEST_ASSERT_EQUAL_INT(Saves % Settings_Slots, Settings_Slot);
+}
+
+void test_damaged_newest_falls_back() {
+  for (int i = 0; i < 3; i++) {
+    Settings_Payload Data = Payload(i + 1);
+    Settings_Save(&Data);
+  }
+  int Address = 2 * sizeof(Settings_Record) + 4;                // first payload byte of the newest record, power lost mid write
+  Settings_Store_Write(Address, Settings_Store_Read(Address) ^ 0x55);
+  Restart();
+  Settings_Payload Loaded;
+  TEST_ASSERT_TRUE(Settings_Load(&Loaded));
+  TEST_ASSERT_TRUE(Loaded.In_FeedRate == 2);
+  TEST_ASSERT_EQUAL_INT(1, Settings_Slot);
+
+  Settings_Payload Next = Payload(9);                           // the next save takes over the damaged slot
+  Settings_Save(&Next);
+  TEST_ASSERT_EQUAL_INT(2, Settings_Slot);
+  Restart();
+  TEST_ASSERT_TRUE(Settings_Load(&Loaded));
+  TEST_ASSERT_TRUE(Loaded.In_FeedRate == 9);
+}
+
+void test_every_record_damaged() {
+  Settings_Payload Data = Payload(1);
+  Settings_Save(&Data);
+  Settings_Store_Write(4, Settings_Store_Read(4) ^ 0x01);
+  Restart();
+  Settings_Payload Loaded = Payload(7);
+  TEST_ASSERT_FALSE(Settings_Load(&Loaded));
+  TEST_ASSERT_TRUE(Loaded.In_FeedRate == 7);
+}
+
+void test_sequence_wraps() {
+  Settings_Sequence = 0xFFFC;                                   // as if it had been saved 65 thousand times
+  for (int i = 1; i <= 5; i++) {                                // sequence 0xFFFD, 0xFFFE, 0xFFFF, 0, 1
+    Settings_Payload Data = Payload(i);
+    Settings_Save(&Data);
+  }
+  TEST_ASSERT_EQUAL_INT(1, Settings_Sequence);
+  Restart();
+  Settings_Payload Loaded;
+  TEST_ASSERT_TRUE(Settings_Load(&Loaded));
+  TEST_ASSERT_TRUE(Loaded.In_FeedRate == 5);                    // 1 is newer than 0xFFFF
+  TEST_ASSERT_EQUAL_INT(4, Settings_Slot);
+
+  int Address = 4 * sizeof(Settings_Record) + 4;                // damaged newest across the wrap still falls back
+  Settings_Store_Write(Address, Settings_Store_Read(Address) ^ 0x55);
+  Restart();
+  TEST_ASSERT_TRUE(Settings_Load(&Loaded));
+  TEST_ASSERT_TRUE(Loaded.In_FeedRate == 4);
+  TEST_ASSERT_EQUAL_INT(0, Settings_Sequence);
+}
+
+void test_other_version_is_ignored() {
+  Write_Slot(0, Settings_Version - 1, 5, 1);                    // good CRC, old layout
+  Settings_Payload Loaded = Payload(7);
+  TEST_ASSERT_FALSE(Settings_Load(&Loaded));
+  TEST_ASSERT_TRUE(Loaded.In_FeedRate == 7);
+
+  Write_Slot(1, Settings_Version, 3, 2);                        // this version, but older than the slot 0 record
+  Write_Slot(2, Settings_Version + 1, 9, 3);
+  Restart();
+  TEST_ASSERT_TRUE(Settings_Load(&Loaded));
+  TEST_ASSERT_TRUE(Loaded.In_FeedRate == 2);
+  TEST_ASSERT_EQUAL_INT(1, Settings_Slot);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_empty_store_loads_nothing);
+  RUN_TEST(test_save_and_load);
+  RUN_TEST(test_saves_go_round_the_ring);
+  RUN_TEST(test_damaged_newest_falls_back);
+  RUN_TEST(test_every_record_damaged);
+  RUN_TEST(test_sequence_wraps);
+  RUN_TEST(test_other_version_is_ignored);
+  return UNITY_END();
+}